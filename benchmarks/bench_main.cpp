@@ -0,0 +1,1109 @@
+// benchmarks/bench_main.cpp
+// Micro-benchmarks for the core data structures and load paths.
+// Build (from the repository root):
+//   g++ -std=c++11 -O3 -pthread -I./src benchmarks/bench_main.cpp $(ls src/*.cpp | grep -v main.cpp) -o bench_driver
+// Usage:
+//   ./bench_driver [catalog_megabytes]   (default 64; use 1024 for the 1 GB run)
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+
+#include "../src/LinkedList.h"
+#include "../src/SmallList.h"
+#include "../src/Ingredient.h"
+#include "../src/Recipe.h"
+#include "../src/RecipeManager.h"
+#include "../src/RecipeParser.h"
+#include "../src/ThreadPool.h"
+#include "../src/IngredientPool.h"
+#include "../src/Quantity.h"
+#include "../src/RecipeStore.h"
+#include "../src/GroceryList.h"
+#include "../src/ScaledRecipe.h"
+#include "../src/TitleIndex.h"
+#include "../src/TitleLookup.h"
+#include "../src/IngredientIndex.h"
+#include "../src/FuzzySearch.h"
+#include "../src/VeganRecipe.h"
+#include "../src/BitmapIndex.h"
+#include "../src/PrepTimeIndex.h"
+#include "../src/QueryEngine.h"
+#include "../src/SortedViews.h"
+
+// Function prototypes for benchmarks
+void benchNodeAllocation();
+void benchSorting();
+void benchParsing(int catalogMegabytes);
+void benchInterning();
+void benchQuantities();
+void benchGroceryLists();
+void benchScaling();
+void benchTitleSearch();
+void benchFuzzySearch();
+void benchBitmapFilters();
+void benchQueries();
+void benchPrepTimeRanges();
+void benchTopK();
+void benchSortedViews();
+void benchTitleLookup();
+void benchErase();
+void benchPositionalAccess();
+void benchIngredientLists();
+void benchCopyAndMove();
+
+// --- Timing helpers ---
+typedef std::chrono::steady_clock BenchClock;
+
+double elapsedMs(BenchClock::time_point start) {
+    return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+}
+
+void printResult(const std::string& label, double ms) {
+    std::cout << "  " << std::left << std::setw(40) << label
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2) << ms << " ms\n";
+}
+
+int main(int argc, char* argv[]) {
+    int catalogMegabytes = (argc > 1) ? std::atoi(argv[1]) : 64;
+    if (catalogMegabytes <= 0) catalogMegabytes = 64;
+
+    std::cout << "Running benchmarks...\n";
+
+    benchNodeAllocation();
+    benchSorting();
+    benchParsing(catalogMegabytes);
+    benchInterning();
+    benchQuantities();
+    benchGroceryLists();
+    benchScaling();
+    benchTitleSearch();
+    benchFuzzySearch();
+    benchBitmapFilters();
+    benchQueries();
+    benchPrepTimeRanges();
+    benchTopK();
+    benchSortedViews();
+    benchTitleLookup();
+    benchErase();
+    benchPositionalAccess();
+    benchIngredientLists();
+    benchCopyAndMove();
+
+    std::cout << "Benchmarks complete.\n";
+    return 0;
+}
+
+// Bulk load, iteration and teardown of a 1M-ingredient catalog with
+// node-per-new storage versus the pooled node allocator.
+void runNodeAllocation(NodeAllocation allocation, const std::string& label) {
+    const int INGREDIENTS = 1000000;
+    const char* names[] = { "onion", "garlic", "olive oil", "tomato", "basil", "flour", "sugar", "butter" };
+
+    LinkedList<Ingredient>* ingredients = new LinkedList<Ingredient>(allocation);
+
+    BenchClock::time_point start = BenchClock::now();
+    for (int i = 0; i < INGREDIENTS; ++i) {
+        ingredients->push_back(Ingredient(names[i % 8], "100g"));
+    }
+    printResult(label + " load", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t totalLength = 0;
+    for (LinkedList<Ingredient>::const_iterator it = ingredients->cbegin(); it != ingredients->cend(); ++it) {
+        totalLength += it->getName().size();
+    }
+    printResult(label + " iterate", elapsedMs(start));
+
+    start = BenchClock::now();
+    delete ingredients;
+    printResult(label + " teardown", elapsedMs(start));
+
+    if (totalLength == 0) std::cout << "  (unexpected empty catalog)\n";
+}
+
+void benchNodeAllocation() {
+    std::cout << "Benchmarking LinkedList node allocation (1M ingredients)...\n";
+    runNodeAllocation(NodeAllocation::PerNode, "per-node new");
+    runNodeAllocation(NodeAllocation::Pooled, "pooled");
+}
+
+// Sorting 200k titles: shuffled input through mergeSort and the adaptive
+// sort, then re-sorting the already sorted list (insertion fast path).
+void benchSorting() {
+    std::cout << "Benchmarking LinkedList sorting (200k titles)...\n";
+    const int TITLES = 200000;
+
+    LinkedList<std::string> titles;
+    for (int i = 0; i < TITLES; ++i) {
+        std::ostringstream oss;
+        oss << "Recipe " << (static_cast<long long>(i) * 7919) % TITLES;
+        titles.push_back(oss.str());
+    }
+
+    BenchClock::time_point start = BenchClock::now();
+    titles.mergeSort(std::less<std::string>());
+    printResult("mergeSort shuffled", elapsedMs(start));
+
+    start = BenchClock::now();
+    titles.sort(std::less<std::string>());
+    printResult("adaptive sort already sorted", elapsedMs(start));
+}
+
+// --- Synthetic catalog ---
+const char* const SYNTHETIC_INGREDIENTS[] = { "onion:40g", "garlic:1clove", "olive oil:1tbsp", "tomato:100g", "basil:10g",
+                                              "rice:150g", "lentils:150g", "carrot:50g", "spinach:50g", "flour:2cups" };
+
+// Writes roughly 'megabytes' MB of recipes.txt-style lines and returns the line count.
+int writeSyntheticCatalog(const std::string& filename, int megabytes) {
+    const char* types[] = { "Vegan", "Vegetarian", "Omnivore" };
+    const char* meals[] = { "Breakfast", "Lunch", "Dinner", "Snack", "Dessert" };
+    const char* const* ingredients = SYNTHETIC_INGREDIENTS;
+    const std::size_t targetBytes = static_cast<std::size_t>(megabytes) * 1024 * 1024;
+
+    std::ofstream out(filename.c_str(), std::ios::binary);
+    std::string line;
+    std::size_t written = 0;
+    int lines = 0;
+    while (written < targetBytes) {
+        const char* type = types[lines % 3];
+        std::ostringstream oss;
+        oss << type << "|Synthetic Recipe " << lines << "|" << (lines % 120) + 1 << "|"
+            << meals[lines % 5] << "|" << type << "|";
+        for (int j = 0; j < 5; ++j) {
+            if (j) oss << ";";
+            oss << ingredients[(lines + j * 3) % 10];
+        }
+        oss << "\n";
+        line = oss.str();
+        out << line;
+        written += line.size();
+        lines++;
+    }
+    return lines;
+}
+
+// The loader as it was before RecipeParser: one istringstream per line and
+// per ingredient list, one std::string per token. Kept here as the baseline.
+Recipe* legacyDeserialize(const std::string& data) {
+    std::istringstream iss(data);
+    std::string type, title, mealTypeStr, dietTypeStr, ingredientsStr;
+    int prepTime = 0;
+    std::getline(iss, type, '|');
+    std::getline(iss, title, '|');
+    iss >> prepTime;
+    iss.ignore();
+    std::getline(iss, mealTypeStr, '|');
+    std::getline(iss, dietTypeStr, '|');
+    std::getline(iss, ingredientsStr);
+
+    Recipe* recipe = RecipeManager::addRecipe(title, prepTime, stringToMealType(mealTypeStr), stringToDietType(type));
+    std::istringstream ingredientsStream(ingredientsStr);
+    std::string ingredientPair;
+    while (std::getline(ingredientsStream, ingredientPair, ';')) {
+        std::size_t colonPos = ingredientPair.find(':');
+        if (colonPos != std::string::npos) {
+            recipe->addIngredient(Ingredient(ingredientPair.substr(0, colonPos), ingredientPair.substr(colonPos + 1)));
+        }
+    }
+    return recipe;
+}
+
+void benchParsing(int catalogMegabytes) {
+    std::cout << "Benchmarking catalog parsing (" << catalogMegabytes << " MB synthetic recipes.txt)...\n";
+    const std::string fileName = "bench_catalog.txt";
+    int lines = writeSyntheticCatalog(fileName, catalogMegabytes);
+
+    BenchClock::time_point start = BenchClock::now();
+    {
+        LinkedList<Recipe*> recipes;
+        std::ifstream inFile(fileName.c_str());
+        std::string line;
+        while (std::getline(inFile, line)) {
+            if (line.empty()) continue;
+            recipes.push_back(legacyDeserialize(line));
+        }
+        if (recipes.size() != lines) std::cout << "  (legacy loader lost lines)\n";
+    }
+    double legacyMs = elapsedMs(start);
+    printResult("getline + istringstream", legacyMs);
+
+    start = BenchClock::now();
+    {
+        LinkedList<Recipe*> recipes;
+        std::vector<ParseError> errors;
+        RecipeParser::parseFile(fileName, recipes, errors);
+        if (recipes.size() != lines) std::cout << "  (RecipeParser lost lines)\n";
+    }
+    double parserMs = elapsedMs(start);
+    printResult("RecipeParser block reader", parserMs);
+    std::cout << "  speedup: " << std::setprecision(2) << legacyMs / parserMs << "x\n";
+
+    // Floor shared by every loader: constructing the same recipes from
+    // prebuilt parts and freeing them again, with no text to parse
+    const int meals = 5;
+    Ingredient parts[10];
+    for (int k = 0; k < 10; ++k) {
+        std::string pair = SYNTHETIC_INGREDIENTS[k];
+        std::size_t colon = pair.find(':');
+        parts[k] = Ingredient(pair.substr(0, colon), pair.substr(colon + 1));
+    }
+    start = BenchClock::now();
+    {
+        LinkedList<Recipe*> recipes;
+        for (int i = 0; i < lines; ++i) {
+            DietType type = (i % 3 == 0) ? DietType::Vegan : (i % 3 == 1) ? DietType::Vegetarian : DietType::Omnivore;
+            Recipe* recipe = RecipeManager::addRecipe("Synthetic Recipe " + std::to_string(i), (i % 120) + 1,
+                                                      static_cast<MealType>(i % meals), type);
+            for (int j = 0; j < 5; ++j) {
+                recipe->addIngredient(parts[(i + j * 3) % 10]);
+            }
+            recipes.push_back(recipe);
+        }
+    }
+    double floorMs = elapsedMs(start);
+    printResult("build + free recipes only (floor)", floorMs);
+    if (parserMs > floorMs) {
+        std::cout << "  parsing work speedup (above the floor): " << std::setprecision(2)
+                  << (legacyMs - floorMs) / (parserMs - floorMs) << "x\n";
+    }
+
+    unsigned threads = ThreadPool::defaultThreadCount();
+    start = BenchClock::now();
+    {
+        LinkedList<Recipe*> recipes;
+        std::vector<ParseError> errors;
+        RecipeParser::parseFileParallel(fileName, recipes, errors, threads);
+        if (recipes.size() != lines) std::cout << "  (parallel parser lost lines)\n";
+    }
+    double parallelMs = elapsedMs(start);
+    std::ostringstream label;
+    label << "RecipeParser parallel (" << threads << " threads)";
+    printResult(label.str(), parallelMs);
+    std::cout << "  speedup: " << std::setprecision(2) << legacyMs / parallelMs << "x\n";
+
+    std::remove(fileName.c_str());
+}
+
+// Ingredient name memory on a 16 MB synthetic catalog, and 100 lookups of
+// one ingredient across every recipe: string compares versus interned ids.
+void benchInterning() {
+    std::cout << "Benchmarking ingredient name interning (16 MB synthetic catalog)...\n";
+    const std::string fileName = "bench_interning.txt";
+    const int LOOKUPS = 100;
+    writeSyntheticCatalog(fileName, 16);
+    LinkedList<Recipe*> recipes;
+    std::vector<ParseError> errors;
+    RecipeParser::parseFile(fileName, recipes, errors);
+    std::remove(fileName.c_str());
+
+    InternStats stats = RecipeManager::internStats(recipes);
+    std::cout << "  " << stats.references << " ingredient names, "
+              << IngredientPool::instance().idCount() << " distinct\n"
+              << "  as std::string:  " << stats.stringBytes / 1024 << " KB\n"
+              << "  interned:        " << stats.internedBytes / 1024 << " KB (ids + pool)\n"
+              << "  saved:           " << stats.savedBytes() / 1024 << " KB\n";
+
+    const std::string target = "spinach";
+    BenchClock::time_point start = BenchClock::now();
+    std::size_t byName = 0;
+    for (int round = 0; round < LOOKUPS; ++round) {
+        for (LinkedList<Recipe*>::const_iterator it = recipes.cbegin(); it != recipes.cend(); ++it) {
+            const IngredientList& ingredients = (*it)->getIngredients();
+            for (IngredientList::const_iterator ing = ingredients.begin(); ing != ingredients.end(); ++ing) {
+                if (ing->getName() == target) { byName++; break; }
+            }
+        }
+    }
+    printResult("matchesIngredient by string", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t byId = 0;
+    IngredientId id = IngredientPool::instance().find(target);
+    for (int round = 0; round < LOOKUPS; ++round) {
+        for (LinkedList<Recipe*>::const_iterator it = recipes.cbegin(); it != recipes.cend(); ++it) {
+            if ((*it)->matchesIngredient(id)) byId++;
+        }
+    }
+    printResult("matchesIngredient by id", elapsedMs(start));
+    if (byName != byId) std::cout << "  (lookups disagree)\n";
+}
+
+// Totals of 1M quantities: re-parsing the text every time, a per-entry
+// switch over pre-parsed quantities, and the column-wise sum.
+void benchQuantities() {
+    std::cout << "Benchmarking quantity totals (1M quantities)...\n";
+    const int QUANTITIES = 1000000;
+    const int ROUNDS = 20;
+    const char* texts[] = { "200g", "1/2 kg", "2 tbsp", "1 1/2 cups", "3cloves", "50ml", "1 pinch", "to taste" };
+
+    std::vector<std::string> raw;
+    std::vector<Quantity> parsed;
+    raw.reserve(QUANTITIES);
+    parsed.reserve(QUANTITIES);
+    for (int i = 0; i < QUANTITIES; ++i) {
+        raw.push_back(texts[i % 8]);
+        parsed.push_back(Quantity::parse(raw.back()));
+    }
+
+    BenchClock::time_point start = BenchClock::now();
+    std::int64_t fromText = 0;
+    for (int i = 0; i < QUANTITIES; ++i) {
+        Quantity quantity = Quantity::parse(raw[i]);
+        if (quantity.kind() == UnitKind::Mass) fromText += quantity.base;
+    }
+    printResult("parse + sum (1 round)", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::int64_t scalar = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (int i = 0; i < QUANTITIES; ++i) {
+            switch (parsed[i].kind()) {
+                case UnitKind::Mass: scalar += parsed[i].base; break;
+                default: break;
+            }
+        }
+    }
+    printResult("per-entry switch (20 rounds)", elapsedMs(start));
+
+    QuantityColumns columns;
+    columns.reserve(QUANTITIES);
+    for (int i = 0; i < QUANTITIES; ++i) columns.push(parsed[i]);
+    start = BenchClock::now();
+    std::int64_t columnar = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        columnar += columns.sum().milligrams;
+    }
+    printResult("QuantityColumns::sum (20 rounds)", elapsedMs(start));
+    if (scalar != columnar || fromText * ROUNDS != columnar) std::cout << "  (totals disagree)\n";
+}
+
+// Nightly-style batch: 5000 meal plans of 30 recipes each from a 16 MB
+// catalog, merged sequentially and on the thread pool.
+void printPlanRate(const std::string& label, std::size_t plans, double ms) {
+    std::cout << "  " << std::left << std::setw(40) << label
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2) << ms << " ms"
+              << std::setw(12) << std::setprecision(0) << plans / (ms / 1000.0) << " plans/s\n";
+}
+
+void benchGroceryLists() {
+    std::cout << "Benchmarking grocery lists (5000 plans x 30 recipes)...\n";
+    const std::string fileName = "bench_grocery.txt";
+    const int PLANS = 5000;
+    const int RECIPES_PER_PLAN = 30;
+    writeSyntheticCatalog(fileName, 16);
+    LinkedList<Recipe*> recipes;
+    std::vector<ParseError> errors;
+    RecipeParser::parseFile(fileName, recipes, errors);
+    std::remove(fileName.c_str());
+
+    RecipeStore store;
+    store.addAll(recipes);
+    std::vector<MealPlan> plans(PLANS);
+    unsigned seed = 12345;
+    for (int i = 0; i < PLANS; ++i) {
+        for (int j = 0; j < RECIPES_PER_PLAN; ++j) {
+            seed = seed * 1103515245u + 12345u;
+            plans[i].push_back(static_cast<RecipeId>((seed >> 8) % static_cast<unsigned>(store.idLimit())));
+        }
+    }
+
+    GroceryListBuilder builder(store);
+    BenchClock::time_point start = BenchClock::now();
+    std::vector<GroceryList> sequential = builder.buildAll(plans);
+    printPlanRate("sequential", plans.size(), elapsedMs(start));
+
+    ThreadPool pool;
+    start = BenchClock::now();
+    std::vector<GroceryList> parallel = builder.buildAll(plans, &pool);
+    std::ostringstream label;
+    label << "thread pool (" << pool.size() << " threads)";
+    printPlanRate(label.str(), plans.size(), elapsedMs(start));
+    if (sequential.size() != parallel.size() || sequential.back().size() != parallel.back().size()) {
+        std::cout << "  (batches disagree)\n";
+    }
+}
+
+// Batch-cooking export: serializing every recipe of a 16 MB catalog as is
+// and through a x2.5 ScaledRecipe view into one reused buffer.
+void benchScaling() {
+    std::cout << "Benchmarking recipe scaling (16 MB synthetic catalog)...\n";
+    const std::string fileName = "bench_scaling.txt";
+    writeSyntheticCatalog(fileName, 16);
+    LinkedList<Recipe*> recipes;
+    std::vector<ParseError> errors;
+    RecipeParser::parseFile(fileName, recipes, errors);
+    std::remove(fileName.c_str());
+
+    BenchClock::time_point start = BenchClock::now();
+    std::size_t plainBytes = 0;
+    for (LinkedList<Recipe*>::const_iterator it = recipes.cbegin(); it != recipes.cend(); ++it) {
+        plainBytes += (*it)->serialize().size();
+    }
+    printResult("Recipe::serialize (unscaled)", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t scaledBytes = 0;
+    std::string line;
+    for (LinkedList<Recipe*>::const_iterator it = recipes.cbegin(); it != recipes.cend(); ++it) {
+        line.clear();
+        ScaledRecipe(**it, 2.5).appendSerialized(line);
+        scaledBytes += line.size();
+    }
+    printResult("ScaledRecipe::appendSerialized x2.5", elapsedMs(start));
+    if (plainBytes == 0 || scaledBytes == 0) std::cout << "  (unexpected empty catalog)\n";
+}
+
+// 50 substring and prefix queries over a 16 MB catalog: a folded scan of
+// every title versus the TitleIndex.
+void benchTitleSearch() {
+    std::cout << "Benchmarking title search (100 MB synthetic catalog, 50 queries)...\n";
+    const std::string fileName = "bench_titles.txt";
+    const int QUERIES = 50;
+    writeSyntheticCatalog(fileName, 100);
+    LinkedList<Recipe*> recipes;
+    std::vector<ParseError> errors;
+    RecipeParser::parseFile(fileName, recipes, errors);
+    std::remove(fileName.c_str());
+
+    RecipeStore store;
+    store.addAll(recipes);
+    BenchClock::time_point start = BenchClock::now();
+    TitleIndex index;
+    store.addListener(&index);
+    index.findPrefix("", 1); // Title order is merged on the first prefix lookup
+    std::ostringstream built;
+    built << "build index (" << store.size() << " recipes)";
+    printResult(built.str(), elapsedMs(start));
+
+    std::vector<std::string> queries;  // Substrings, e.g. "ECIPE 1237"
+    std::vector<std::string> prefixes; // Type-ahead, e.g. "synthetic recipe 123"
+    for (int i = 0; i < QUERIES; ++i) {
+        std::ostringstream number;
+        number << (i * 7919) % store.size();
+        queries.push_back("ECIPE " + number.str() + "7");
+        prefixes.push_back("synthetic recipe " + number.str());
+    }
+
+    start = BenchClock::now();
+    std::size_t scanned = 0;
+    for (int q = 0; q < QUERIES; ++q) {
+        const std::string folded = TitleIndex::fold(queries[q]);
+        for (LinkedList<Recipe*>::const_iterator it = recipes.cbegin(); it != recipes.cend(); ++it) {
+            if (TitleIndex::fold((*it)->getTitle()).find(folded) != std::string::npos) scanned++;
+        }
+    }
+    printResult("substring by scan", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t indexed = 0;
+    for (int q = 0; q < QUERIES; ++q) {
+        indexed += index.findSubstring(queries[q]).size();
+    }
+    printResult("substring by index", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t prefixed = 0;
+    for (int q = 0; q < QUERIES; ++q) {
+        prefixed += index.findPrefix(prefixes[q], 10).size();
+    }
+    printResult("prefix by index (top 10)", elapsedMs(start));
+    if (scanned != indexed || prefixed == 0) std::cout << "  (searches disagree)\n";
+}
+
+// Pronounceable made-up word for 'n': its base-20 digits as syllables, so
+// the vocabulary has distinct words of 2 to 12 bytes like real titles
+std::string syntheticWord(int n) {
+    const char* syllables[] = { "ba", "ko", "ri", "mel", "sa", "tu", "ven", "lo", "qui", "dar",
+                                "ne", "po", "zor", "fi", "gra", "hu", "ja", "wen", "ly", "cho" };
+    std::string word;
+    do {
+        word += syllables[n % 20];
+        n /= 20;
+    } while (n > 0);
+    return word;
+}
+
+// Latency of 1000 typo queries (title words and ingredient names, one edit
+// each) against 1M recipes whose titles use about 200k distinct words,
+// reported as p50 / p99 per query.
+void benchFuzzySearch() {
+    std::cout << "Benchmarking fuzzy search (1M recipes, 1000 typo queries)...\n";
+    const int RECIPES = 1000000;
+    const int WORDS = 200000;
+    const int QUERIES = 1000;
+    const char* adjectives[] = { "spicy", "creamy", "roasted", "classic", "smoky", "crispy", "quick", "rustic",
+                                 "grilled", "braised", "tangy", "hearty", "fresh", "golden", "sticky", "zesty" };
+    const char* mains[] = { "tomato", "chickpea", "mushroom", "lentil", "pumpkin", "eggplant", "spinach", "potato",
+                            "cauliflower", "zucchini", "broccoli", "carrot", "noodle", "rice", "bean", "tofu" };
+    const char* dishes[] = { "soup", "curry", "salad", "stew", "pasta", "risotto", "tacos", "burger",
+                             "pie", "bake", "skillet", "bowl", "wrap", "gratin", "chili", "frittata" };
+    const char* ingredients[] = { "mozzarella", "chickpeas", "basil", "oregano", "cumin", "coriander", "paprika",
+                                  "garlic", "onion", "ginger", "turmeric", "cinnamon", "parsley", "lemon" };
+
+    LinkedList<Recipe*> recipes;
+    unsigned seed = 2024;
+    for (int i = 0; i < RECIPES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        std::ostringstream title;
+        title << adjectives[(seed >> 4) % 16] << " " << mains[(seed >> 9) % 16] << " " << dishes[(seed >> 14) % 16]
+              << " " << syntheticWord(i % WORDS);
+        Recipe* recipe = new VeganRecipe(title.str(), 30, MealType::Dinner);
+        recipe->addIngredient(Ingredient(ingredients[(seed >> 19) % 14], "10g"));
+        recipes.push_back(recipe);
+    }
+    RecipeStore store;
+    store.addAll(recipes);
+    IngredientIndex ingredientIndex;
+    store.addListener(&ingredientIndex);
+    BenchClock::time_point start = BenchClock::now();
+    FuzzySearch fuzzy(ingredientIndex);
+    store.addListener(&fuzzy);
+    std::ostringstream built;
+    built << "build vocabulary (" << fuzzy.vocabularySize() << " terms)";
+    printResult(built.str(), elapsedMs(start));
+
+    // One deletion or transposition per query word
+    std::vector<std::string> queries;
+    for (int i = 0; i < QUERIES; ++i) {
+        std::string word = (i % 2) ? ingredients[i % 14] : std::string(mains[i % 16]) + " " + dishes[(i / 16) % 16];
+        if (i % 4 == 2) word = syntheticWord(400 + (i * 7919) % 7600); // Three syllables: 6 to 9 bytes
+        std::size_t at = 1 + i % (word.size() - 2);
+        if (word[at] == ' ' || word[at + 1] == ' ' || i % 3 == 0) {
+            word.erase(at, 1);
+        } else {
+            std::swap(word[at], word[at + 1]);
+        }
+        queries.push_back(word);
+    }
+
+    std::vector<double> latencies;
+    std::size_t found = 0;
+    for (int i = 0; i < QUERIES; ++i) {
+        BenchClock::time_point query = BenchClock::now();
+        found += fuzzy.search(queries[i]).size();
+        latencies.push_back(elapsedMs(query));
+    }
+    std::sort(latencies.begin(), latencies.end());
+    printResult("p50 per query", latencies[QUERIES / 2]);
+    printResult("p99 per query", latencies[QUERIES * 99 / 100]);
+    if (found == 0) std::cout << "  (no fuzzy matches)\n";
+
+    recipes.clear();
+}
+
+// "Vegan AND Breakfast AND prepTime<=15" over 1M recipes, 100 times:
+// getters over the recipe list, the store's packed columns, and the
+// BitmapIndex (ids and count only).
+void benchBitmapFilters() {
+    std::cout << "Benchmarking meal/diet/prep-time filters (1M recipes, 100 rounds)...\n";
+    const int RECIPES = 1000000;
+    const int ROUNDS = 100;
+    LinkedList<Recipe*> recipes;
+    unsigned seed = 77;
+    for (int i = 0; i < RECIPES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        Recipe* recipe = new VeganRecipe("Recipe", static_cast<int>((seed >> 8) % 120) + 1,
+                                         static_cast<MealType>((seed >> 16) % MEAL_TYPE_COUNT));
+        recipe->setDietType(static_cast<DietType>((seed >> 20) % DIET_TYPE_COUNT));
+        recipes.push_back(recipe);
+    }
+    RecipeStore store;
+    store.addAll(recipes);
+    BitmapIndex index;
+    store.addListener(&index);
+
+    BenchClock::time_point start = BenchClock::now();
+    std::size_t scanned = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (LinkedList<Recipe*>::const_iterator it = recipes.cbegin(); it != recipes.cend(); ++it) {
+            if ((*it)->getDietType() == DietType::Vegan && (*it)->getMealType() == MealType::Breakfast &&
+                (*it)->getPrepTime() <= 15) {
+                scanned++;
+            }
+        }
+    }
+    printResult("recipe list getters", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t columns = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        PostingList vegan = store.findByDietType(DietType::Vegan);
+        for (std::size_t i = 0; i < vegan.size(); ++i) {
+            if (store.getMealType(vegan[i]) == MealType::Breakfast && store.getPrepTime(vegan[i]) <= 15) columns++;
+        }
+    }
+    printResult("store columns", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t bitmapIds = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        bitmapIds += index.filter(DietType::Vegan, MealType::Breakfast, 15).toPostingList().size();
+    }
+    printResult("bitmap AND -> ids", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t bitmapCount = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        bitmapCount += Bitset::countAnd(index.withDietType(DietType::Vegan), index.withMealType(MealType::Breakfast));
+    }
+    printResult("bitmap AND popcount (diet + meal)", elapsedMs(start));
+    std::cout << "  index: " << index.bytes() / 1024 << " KB\n";
+    if (scanned != columns || scanned != bitmapIds || bitmapCount < bitmapIds) std::cout << "  (filters disagree)\n";
+
+    recipes.clear();
+}
+
+// "diet:vegan meal:dinner prep<30 ing:saffron -ing:tofu" over 200k recipes,
+// 100 times: the planned query (rare ingredient first) versus evaluating
+// the terms in the order written, starting from the diet column.
+void benchQueries() {
+    std::cout << "Benchmarking planned queries (200k recipes, 100 rounds)...\n";
+    const int RECIPES = 200000;
+    const int ROUNDS = 100;
+    const char* names[] = { "onion", "garlic", "tomato", "spinach", "rice", "tofu", "basil", "carrot" };
+    LinkedList<Recipe*> recipes;
+    unsigned seed = 91;
+    for (int i = 0; i < RECIPES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        Recipe* recipe = new VeganRecipe("Recipe", static_cast<int>((seed >> 8) % 120) + 1,
+                                         static_cast<MealType>((seed >> 16) % MEAL_TYPE_COUNT));
+        recipe->setDietType(static_cast<DietType>((seed >> 20) % DIET_TYPE_COUNT));
+        unsigned first = (seed >> 4) % 8;
+        unsigned second = (first + 1 + (seed >> 12) % 7) % 8; // Never the same as 'first'
+        recipe->addIngredient(Ingredient(names[first], "100g"));
+        recipe->addIngredient(Ingredient(names[second], "50g"));
+        if (i % 500 == 0) recipe->addIngredient(Ingredient("saffron", "1 pinch"));
+        recipes.push_back(recipe);
+    }
+    RecipeStore store;
+    store.addAll(recipes);
+    IngredientIndex ingredients;
+    store.addListener(&ingredients);
+    TitleIndex titles;
+    store.addListener(&titles);
+    BitmapIndex bitmaps;
+    store.addListener(&bitmaps);
+    PrepTimeIndex prepTimes;
+    store.addListener(&prepTimes);
+    QueryEngine engine(store, ingredients, titles, bitmaps, prepTimes);
+    Query query = Query::parse("diet:vegan meal:dinner prep<30 ing:saffron -ing:tofu");
+
+    BenchClock::time_point start = BenchClock::now();
+    std::size_t written = 0;
+    const PostingList* saffron = ingredients.find(IngredientPool::instance().find("saffron"));
+    const PostingList* tofu = ingredients.find(IngredientPool::instance().find("tofu"));
+    for (int round = 0; round < ROUNDS; ++round) {
+        PostingList vegan = store.findByDietType(DietType::Vegan);
+        for (std::size_t i = 0; i < vegan.size(); ++i) {
+            RecipeId id = vegan[i];
+            if (store.getMealType(id) == MealType::Dinner && store.getPrepTime(id) < 30 &&
+                std::binary_search(saffron->begin(), saffron->end(), id) &&
+                !std::binary_search(tofu->begin(), tofu->end(), id)) {
+                written++;
+            }
+        }
+    }
+    printResult("terms in written order", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t planned = 0;
+    QueryResult result;
+    for (int round = 0; round < ROUNDS; ++round) {
+        result = engine.run(query);
+        planned += result.ids.size();
+    }
+    printResult("planned (estimates included)", elapsedMs(start));
+    std::cout << result.explain();
+    if (written != planned) std::cout << "  (plans disagree)\n";
+
+    recipes.clear();
+}
+
+// "Under 20 minutes" over 1M recipes, 100 times: the store's prep-time
+// column scan versus the PrepTimeIndex range scan, count, top 20 fastest
+// and 15-minute histogram.
+void benchPrepTimeRanges() {
+    std::cout << "Benchmarking prep-time ranges (1M recipes, 100 rounds)...\n";
+    const int RECIPES = 1000000;
+    const int ROUNDS = 100;
+    LinkedList<Recipe*> recipes;
+    unsigned seed = 29;
+    for (int i = 0; i < RECIPES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        recipes.push_back(new VeganRecipe("Recipe", static_cast<int>((seed >> 8) % 240) + 1, MealType::Dinner));
+    }
+    RecipeStore store;
+    store.addAll(recipes);
+    PrepTimeIndex index;
+    store.addListener(&index);
+
+    BenchClock::time_point start = BenchClock::now();
+    std::size_t scanned = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        scanned += store.findByMaxPrepTime(19).size();
+    }
+    printResult("column scan", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t ranged = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        ranged += index.findRange(0, 19).size();
+    }
+    printResult("range index -> ids", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t counted = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        counted += index.countRange(0, 19);
+    }
+    printResult("range index count", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t fastest = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        fastest += index.fastest(20, 19).size();
+    }
+    printResult("top 20 fastest", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t buckets = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        buckets += index.histogram(15).size();
+    }
+    printResult("histogram (15-minute buckets)", elapsedMs(start));
+    if (scanned != ranged || ranged != counted || fastest != 20 * ROUNDS || buckets == 0) std::cout << "  (ranges disagree)\n";
+
+    recipes.clear();
+}
+
+// The 10 quickest and 10 alphabetically first of 1M recipes: topK's
+// bounded heap versus sorting the whole list.
+void benchTopK() {
+    std::cout << "Benchmarking top-10 selection (1M recipes)...\n";
+    const int RECIPES = 1000000;
+    LinkedList<Recipe*> recipes;
+    unsigned seed = 53;
+    for (int i = 0; i < RECIPES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        std::ostringstream title;
+        title << "Recipe " << (seed >> 4) % RECIPES;
+        recipes.push_back(new VeganRecipe(title.str(), static_cast<int>((seed >> 8) % 240) + 1, MealType::Dinner));
+    }
+
+    BenchClock::time_point start = BenchClock::now();
+    std::vector<Recipe*> quickest = recipes.topK(10, Recipe::compareByPrepTime);
+    printResult("topK 10 by prep time", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::vector<Recipe*> first = recipes.topK(10, Recipe::compareByTitle);
+    printResult("topK 10 by title", elapsedMs(start));
+
+    start = BenchClock::now();
+    recipes.sort(Recipe::compareByPrepTime);
+    printResult("full sort by prep time", elapsedMs(start));
+
+    start = BenchClock::now();
+    recipes.sort(Recipe::compareByTitle);
+    printResult("full sort by title", elapsedMs(start));
+    if (quickest.size() != 10 || first.size() != 10 || (*recipes.begin())->getTitle() != first[0]->getTitle()) std::cout << "  (top-k disagrees)\n";
+
+    recipes.clear();
+}
+
+// 200k recipes: building the maintained views, switching between orders
+// and walking them, and keeping them current through 1000 edits, versus
+// re-sorting the list for every switch.
+void benchSortedViews() {
+    std::cout << "Benchmarking sorted views (200k recipes)...\n";
+    const int RECIPES = 200000;
+    const int EDITS = 1000;
+    LinkedList<Recipe*> recipes;
+    unsigned seed = 61;
+    for (int i = 0; i < RECIPES; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        std::ostringstream title;
+        title << "Recipe " << (seed >> 4) % RECIPES;
+        recipes.push_back(new VeganRecipe(title.str(), static_cast<int>((seed >> 8) % 240) + 1,
+                                          static_cast<MealType>((seed >> 16) % MEAL_TYPE_COUNT)));
+    }
+    RecipeStore store;
+    store.addAll(recipes);
+
+    BenchClock::time_point start = BenchClock::now();
+    recipes.sort(Recipe::compareByTitle);
+    recipes.sort(Recipe::compareByPrepTime);
+    recipes.sort(Recipe::compareByMealType);
+    printResult("list re-sort x3 (title, prep, meal)", elapsedMs(start));
+
+    start = BenchClock::now();
+    SortedViews views;
+    store.addListener(&views);
+    views.view(SortOrder::Title);
+    printResult("build all three views", elapsedMs(start));
+
+    start = BenchClock::now();
+    long long walked = 0;
+    for (int i = 0; i < SORT_ORDER_COUNT; ++i) {
+        const std::vector<RecipeId>& view = views.view(static_cast<SortOrder>(i));
+        for (std::size_t j = 0; j < view.size(); ++j) walked += store.getPrepTime(view[j]);
+    }
+    printResult("switch + walk x3", elapsedMs(start));
+
+    start = BenchClock::now();
+    for (int i = 0; i < EDITS; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        Recipe* recipe = store.get(static_cast<RecipeId>((seed >> 4) % RECIPES));
+        recipe->setPrepTime(static_cast<int>((seed >> 8) % 240) + 1);
+    }
+    printResult("1000 prep-time edits (views updated)", elapsedMs(start));
+    if (walked == 0 || views.size() != RECIPES) std::cout << "  (views incomplete)\n";
+
+    recipes.clear();
+}
+
+// 1000 exact-title lookups among 1M recipes: the driver's old list scan
+// versus the TitleLookup hash probe (exact, then ignoring case).
+void benchTitleLookup() {
+    std::cout << "Benchmarking title lookups (1M recipes, 1000 lookups)...\n";
+    const int RECIPES = 1000000;
+    const int LOOKUPS = 1000;
+    LinkedList<Recipe*> recipes;
+    for (int i = 0; i < RECIPES; ++i) {
+        std::ostringstream title;
+        title << "Recipe " << i;
+        recipes.push_back(new VeganRecipe(title.str(), 10, MealType::Dinner));
+    }
+    RecipeStore store;
+    store.addAll(recipes);
+    BenchClock::time_point start = BenchClock::now();
+    TitleLookup titles;
+    store.addListener(&titles);
+    printResult("build lookup", elapsedMs(start));
+
+    std::vector<std::string> wanted;
+    for (int i = 0; i < LOOKUPS; ++i) {
+        std::ostringstream title;
+        title << "Recipe " << (static_cast<long long>(i) * 7919) % RECIPES;
+        wanted.push_back(title.str());
+    }
+
+    start = BenchClock::now();
+    std::size_t scanned = 0;
+    for (int i = 0; i < LOOKUPS / 10; ++i) { // A tenth of the lookups; each is a full scan
+        for (LinkedList<Recipe*>::const_iterator it = recipes.cbegin(); it != recipes.cend(); ++it) {
+            if ((*it)->getTitle() == wanted[i]) {
+                scanned++;
+                break;
+            }
+        }
+    }
+    printResult("list scan x100", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t hashed = 0;
+    for (int i = 0; i < LOOKUPS; ++i) {
+        hashed += titles.find(wanted[i]).size();
+    }
+    printResult("hash lookup x1000", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::size_t folded = 0;
+    for (int i = 0; i < LOOKUPS; ++i) {
+        folded += titles.findIgnoringCase(wanted[i]).size();
+    }
+    printResult("case-insensitive lookup x1000", elapsedMs(start));
+    if (scanned != LOOKUPS / 10 || hashed != LOOKUPS || folded != LOOKUPS) std::cout << "  (lookups disagree)\n";
+
+    recipes.clear();
+}
+
+// Removing 1000 known elements from a 1M-element list: removeIf (a walk
+// from head per removal) versus erase through held iterators, then one
+// erase_if pass and a splice of two 500k lists.
+void benchErase() {
+    std::cout << "Benchmarking LinkedList erase (1M elements)...\n";
+    const int ELEMENTS = 1000000;
+    const int REMOVALS = 1000;
+    LinkedList<int> scanned;
+    LinkedList<int> handled;
+    std::vector<LinkedList<int>::iterator> handles;
+    for (int i = 0; i < ELEMENTS; ++i) {
+        scanned.push_back(i);
+        handled.push_back(i);
+    }
+    for (LinkedList<int>::iterator it = handled.begin(); it != handled.end(); ++it) {
+        if (*it % (ELEMENTS / REMOVALS) == ELEMENTS / REMOVALS / 2) handles.push_back(it);
+    }
+
+    BenchClock::time_point start = BenchClock::now();
+    for (int i = 0; i < REMOVALS; ++i) {
+        const int target = i * (ELEMENTS / REMOVALS) + ELEMENTS / REMOVALS / 2;
+        scanned.removeIf([target](int value) { return value == target; });
+    }
+    printResult("removeIf x1000", elapsedMs(start));
+
+    start = BenchClock::now();
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+        handled.erase(handles[i]);
+    }
+    printResult("erase(iterator) x1000", elapsedMs(start));
+
+    start = BenchClock::now();
+    int removed = handled.erase_if([](int value) { return value % 3 == 0; });
+    printResult("erase_if (every third)", elapsedMs(start));
+
+    LinkedList<int> first;
+    LinkedList<int> second;
+    for (int i = 0; i < ELEMENTS / 2; ++i) {
+        first.push_back(i);
+        second.push_back(i);
+    }
+    start = BenchClock::now();
+    first.splice(first.end(), second);
+    printResult("splice 500k + 500k", elapsedMs(start));
+    if (scanned.size() != handled.size() + removed || first.size() != ELEMENTS) std::cout << "  (lists disagree)\n";
+}
+
+// 1000 numbered-menu picks from a 1M-element list: advancing an iterator
+// from the head versus iteratorAt through the skip index (built by the
+// first pick), plus a full reverse walk.
+void benchPositionalAccess() {
+    std::cout << "Benchmarking LinkedList positional access (1M elements, 1000 picks)...\n";
+    const int ELEMENTS = 1000000;
+    const int PICKS = 1000;
+    LinkedList<int> list;
+    for (int i = 0; i < ELEMENTS; ++i) list.push_back(i);
+
+    BenchClock::time_point start = BenchClock::now();
+    long long walked = 0;
+    for (int pick = 0; pick < PICKS; ++pick) {
+        const int index = static_cast<int>((static_cast<long long>(pick) * 7919) % ELEMENTS);
+        LinkedList<int>::iterator it = list.begin();
+        for (int i = 0; i < index; ++i) ++it;
+        walked += *it;
+    }
+    printResult("advance from head", elapsedMs(start));
+
+    start = BenchClock::now();
+    long long indexed = 0;
+    for (int pick = 0; pick < PICKS; ++pick) {
+        const int index = static_cast<int>((static_cast<long long>(pick) * 7919) % ELEMENTS);
+        indexed += *list.iteratorAt(index);
+    }
+    printResult("iteratorAt (skip index)", elapsedMs(start));
+
+    start = BenchClock::now();
+    long long reversed = 0;
+    for (LinkedList<int>::reverse_iterator it = list.rbegin(); it != list.rend(); ++it) reversed += *it;
+    printResult("reverse walk", elapsedMs(start));
+    if (walked != indexed || reversed != static_cast<long long>(ELEMENTS) * (ELEMENTS - 1) / 2) std::cout << "  (positions disagree)\n";
+}
+
+// 200k recipes of 5 ingredients: building and scanning per-recipe ingredient
+// lists as pooled LinkedLists versus SmallLists (all inline).
+template <typename List>
+void runIngredientLists(const std::string& label) {
+    const int RECIPES = 200000;
+    const int PER_RECIPE = 5;
+    const char* names[] = { "onion", "garlic", "olive oil", "tomato", "basil", "flour", "sugar", "butter" };
+
+    BenchClock::time_point start = BenchClock::now();
+    std::vector<List*> lists;
+    lists.reserve(RECIPES);
+    for (int r = 0; r < RECIPES; ++r) {
+        List* list = new List();
+        for (int i = 0; i < PER_RECIPE; ++i) list->push_back(Ingredient(names[(r + i) % 8], "100g"));
+        lists.push_back(list);
+    }
+    printResult(label + " build", elapsedMs(start));
+
+    start = BenchClock::now();
+    long long ids = 0;
+    for (int pass = 0; pass < 10; ++pass) {
+        for (std::size_t r = 0; r < lists.size(); ++r) {
+            for (typename List::const_iterator it = lists[r]->cbegin(); it != lists[r]->cend(); ++it) ids += it->getId();
+        }
+    }
+    printResult(label + " scan x10", elapsedMs(start));
+
+    start = BenchClock::now();
+    for (std::size_t r = 0; r < lists.size(); ++r) delete lists[r];
+    printResult(label + " teardown", elapsedMs(start));
+    if (ids == 0) std::cout << "  (unexpected empty lists)\n";
+}
+
+// Measured, not assumed: object sizes and the 64-byte cache lines that
+// the five ingredients of a heap-allocated recipe actually span.
+void reportIngredientFootprint() {
+    const int RECIPES = 10000;
+    const char* names[] = { "onion", "garlic", "olive oil", "tomato", "basil", "flour", "sugar", "rice" };
+    std::vector<VeganRecipe*> recipes;
+    std::size_t lines = 0;
+    for (int r = 0; r < RECIPES; ++r) {
+        VeganRecipe* recipe = new VeganRecipe("Recipe " + std::to_string(r), 10, MealType::Lunch);
+        for (int i = 0; i < 5; ++i) recipe->addIngredient(Ingredient(names[(r + i) % 8], "100g"));
+        const IngredientList& ingredients = recipe->getIngredients();
+        std::uintptr_t first = reinterpret_cast<std::uintptr_t>(&*ingredients.begin());
+        std::uintptr_t last = reinterpret_cast<std::uintptr_t>(&*ingredients.rbegin()) + sizeof(Ingredient) - 1;
+        lines += last / 64 - first / 64 + 1;
+        recipes.push_back(recipe);
+    }
+    std::cout << "  sizeof(Ingredient) " << sizeof(Ingredient) << " B, sizeof(IngredientList) " << sizeof(IngredientList)
+              << " B, sizeof(VeganRecipe) " << sizeof(VeganRecipe) << " B\n"
+              << "  5 ingredients span " << std::setprecision(2) << static_cast<double>(lines) / RECIPES
+              << " cache lines on average\n";
+    for (std::size_t r = 0; r < recipes.size(); ++r) delete recipes[r];
+}
+
+void benchIngredientLists() {
+    std::cout << "Benchmarking per-recipe ingredient lists (200k recipes x 5)...\n";
+    reportIngredientFootprint();
+    runIngredientLists<LinkedList<Ingredient> >("LinkedList");
+    runIngredientLists<IngredientList>("SmallList");
+}
+
+// Copy versus move of a 1M-element LinkedList, and of 100k detached
+// recipes with 6 ingredients each.
+void benchCopyAndMove() {
+    std::cout << "Benchmarking copy vs move (1M-element list, 100k recipes)...\n";
+    const int ELEMENTS = 1000000;
+    const int RECIPES = 100000;
+    const char* names[] = { "onion", "garlic", "olive oil", "tomato", "basil", "flour", "sugar", "rice" };
+
+    LinkedList<std::string> list;
+    for (int i = 0; i < ELEMENTS; ++i) list.push_back("ingredient text " + std::to_string(i));
+
+    BenchClock::time_point start = BenchClock::now();
+    LinkedList<std::string> copied(list);
+    printResult("list copy", elapsedMs(start));
+
+    start = BenchClock::now();
+    LinkedList<std::string> moved(std::move(list));
+    printResult("list move", elapsedMs(start));
+
+    std::vector<VeganRecipe> recipes;
+    recipes.reserve(RECIPES);
+    for (int r = 0; r < RECIPES; ++r) {
+        recipes.push_back(VeganRecipe("Recipe " + std::to_string(r), r % 90, MealType::Dinner));
+        for (int i = 0; i < 6; ++i) recipes.back().addIngredient(Ingredient(names[(r + i) % 8], "2 cups, finely chopped"));
+    }
+
+    start = BenchClock::now();
+    std::vector<VeganRecipe> recipeCopies(recipes.begin(), recipes.end());
+    printResult("recipe copies", elapsedMs(start));
+
+    start = BenchClock::now();
+    std::vector<VeganRecipe> recipeMoves(std::make_move_iterator(recipes.begin()), std::make_move_iterator(recipes.end()));
+    printResult("recipe moves", elapsedMs(start));
+
+    if (copied.size() != moved.size() || recipeCopies.size() != recipeMoves.size()) std::cout << "  (sizes disagree)\n";
+}
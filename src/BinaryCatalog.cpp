@@ -0,0 +1,312 @@
+// src/BinaryCatalog.cpp
+// Writer and memory-mapped reader for the binary recipe catalog.
+#include "BinaryCatalog.h"
+#include "RecipeManager.h"
+#include "Checksum.h"
+#include "FileSync.h"
+#include "IngredientPool.h"
+#include <cctype>    // For std::tolower
+#include <cstring>   // For std::memcpy, std::memcmp
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+    const char MAGIC[4] = { 'R', 'C', 'P', 'B' };
+    const std::size_t WRITE_BLOCK_SIZE = 1 << 20; // Bytes per write
+
+    std::uint64_t alignTo8(std::uint64_t value) {
+        return (value + 7) & ~static_cast<std::uint64_t>(7);
+    }
+
+    // Deduplicating string table builder
+    class StringTable {
+    private:
+        std::string bytes;
+        std::unordered_map<std::string, std::uint32_t> offsets;
+    public:
+        std::uint32_t add(const std::string& value) {
+            std::unordered_map<std::string, std::uint32_t>::iterator it = offsets.find(value);
+            if (it != offsets.end()) {
+                return it->second;
+            }
+            std::uint32_t offset = static_cast<std::uint32_t>(bytes.size());
+            bytes.append(value);
+            offsets[value] = offset;
+            return offset;
+        }
+        const std::string& data() const { return bytes; }
+    };
+
+    template <typename T>
+    void appendRaw(std::string& buffer, const T& value) {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void padTo8(std::string& buffer) {
+        buffer.append(static_cast<std::size_t>(alignTo8(buffer.size()) - buffer.size()), '\0');
+    }
+}
+
+// --- Constructor/Destructor ---
+BinaryCatalog::BinaryCatalog()
+    : header(nullptr), records(nullptr), ingredients(nullptr), strings(nullptr) {}
+
+BinaryCatalog::~BinaryCatalog() {
+    close();
+}
+
+// --- Writing ---
+// Builds the three tables in memory, then writes header + body through a
+// temp file that replaces the target only once it is on disk.
+void BinaryCatalog::write(const std::string& filename, const LinkedList<Recipe*>& recipes) {
+    std::string recordBytes;
+    std::string ingredientBytes;
+    StringTable stringTable;
+    std::uint32_t recipeCount = 0;
+    std::uint32_t ingredientCount = 0;
+
+    for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
+        const Recipe* recipe = *it;
+        if (!recipe) continue;
+
+        const std::string title = recipe->getTitle();
+        Record record;
+        std::memset(&record, 0, sizeof(record));
+        record.titleOffset = stringTable.add(title);
+        record.titleLength = static_cast<std::uint32_t>(title.size());
+        record.prepTime = recipe->getPrepTime();
+        record.recipeType = static_cast<std::uint8_t>(stringToDietType(recipe->getTypeString()));
+        record.mealType = static_cast<std::uint8_t>(recipe->getMealType());
+        record.dietType = static_cast<std::uint8_t>(recipe->getDietType());
+        record.firstIngredient = ingredientCount;
+
+        const IngredientList& list = recipe->getIngredients();
+        for (IngredientList::const_iterator ing = list.begin(); ing != list.end(); ++ing) {
+            const std::string name = ing->getName();
+            const std::string quantity = ing->getQuantity();
+            IngredientEntry entry;
+            entry.nameOffset = stringTable.add(name);
+            entry.nameLength = static_cast<std::uint32_t>(name.size());
+            entry.quantityOffset = stringTable.add(quantity);
+            entry.quantityLength = static_cast<std::uint32_t>(quantity.size());
+            appendRaw(ingredientBytes, entry);
+            record.ingredientCount++;
+            ingredientCount++;
+        }
+        appendRaw(recordBytes, record);
+        recipeCount++;
+    }
+
+    // Body: records, ingredients, strings (each 8-byte aligned)
+    std::string body;
+    body.reserve(recordBytes.size() + ingredientBytes.size() + stringTable.data().size() + 16);
+    Header head;
+    std::memset(&head, 0, sizeof(head));
+    std::memcpy(head.magic, MAGIC, sizeof(MAGIC));
+    head.version = FORMAT_VERSION;
+    head.recipeCount = recipeCount;
+    head.ingredientCount = ingredientCount;
+
+    head.recordOffset = sizeof(Header);
+    body.append(recordBytes);
+    padTo8(body);
+    head.ingredientOffset = sizeof(Header) + body.size();
+    body.append(ingredientBytes);
+    padTo8(body);
+    head.stringOffset = sizeof(Header) + body.size();
+    head.stringSize = stringTable.data().size();
+    body.append(stringTable.data());
+    padTo8(body);
+
+    head.fileSize = sizeof(Header) + body.size();
+    head.bodyChecksum = crc32(body.data(), body.size());
+    head.headerChecksum = crc32(&head, sizeof(head));
+
+    BlockFile out(filename, WRITE_BLOCK_SIZE);
+    out.append(&head, sizeof(head));
+    out.append(body.data(), body.size());
+    out.commit();
+}
+
+// --- Opening ---
+void BinaryCatalog::open(const std::string& filename, bool verifyChecksum) {
+    close();
+
+    if (!file.open(filename)) {
+        throw std::runtime_error("Could not open binary catalog " + filename);
+    }
+    const char* data = file.data();
+    const std::size_t dataSize = file.size();
+
+    // Validate before exposing any pointer into the mapping
+    std::string problem;
+    const Header* candidate = reinterpret_cast<const Header*>(data);
+    if (dataSize < sizeof(Header)) {
+        problem = "file too small for header";
+    } else if (std::memcmp(candidate->magic, MAGIC, sizeof(MAGIC)) != 0) {
+        problem = "bad magic";
+    } else if (candidate->version != FORMAT_VERSION) {
+        problem = "unsupported version";
+    } else {
+        Header copy = *candidate;
+        copy.headerChecksum = 0;
+        if (crc32(&copy, sizeof(copy)) != candidate->headerChecksum) {
+            problem = "header checksum mismatch";
+        } else if (candidate->fileSize != dataSize) {
+            problem = "file size mismatch (torn write?)";
+        } else if (candidate->recordOffset + static_cast<std::uint64_t>(candidate->recipeCount) * sizeof(Record) > candidate->ingredientOffset ||
+                   candidate->ingredientOffset + static_cast<std::uint64_t>(candidate->ingredientCount) * sizeof(IngredientEntry) > candidate->stringOffset ||
+                   candidate->stringOffset + candidate->stringSize > dataSize) {
+            problem = "section out of bounds";
+        } else if (verifyChecksum &&
+                   crc32(data + sizeof(Header), dataSize - sizeof(Header)) != candidate->bodyChecksum) {
+            problem = "body checksum mismatch";
+        }
+    }
+    if (!problem.empty()) {
+        close();
+        throw std::runtime_error("Corrupt binary catalog " + filename + ": " + problem);
+    }
+
+    header = candidate;
+    records = reinterpret_cast<const Record*>(data + header->recordOffset);
+    ingredients = reinterpret_cast<const IngredientEntry*>(data + header->ingredientOffset);
+    strings = data + header->stringOffset;
+}
+
+void BinaryCatalog::close() {
+    file.close();
+    header = nullptr;
+    records = nullptr;
+    ingredients = nullptr;
+    strings = nullptr;
+}
+
+// --- Record Access ---
+const BinaryCatalog::Record& BinaryCatalog::record(std::size_t index) const {
+    if (!header || index >= header->recipeCount) {
+        throw std::out_of_range("Recipe index out of range");
+    }
+    return records[index];
+}
+
+// Record fields are only covered by the optional body checksum, so every
+// table and string reference is bounds-checked before it is followed.
+const BinaryCatalog::IngredientEntry* BinaryCatalog::ingredientsOf(const Record& rec) const {
+    if (static_cast<std::uint64_t>(rec.firstIngredient) + rec.ingredientCount > header->ingredientCount) {
+        throw std::runtime_error("Corrupt binary catalog: ingredient range out of bounds");
+    }
+    return ingredients + rec.firstIngredient;
+}
+
+const BinaryCatalog::IngredientEntry& BinaryCatalog::ingredientEntry(std::size_t recipeIndex, std::size_t ingredientIndex) const {
+    const Record& rec = record(recipeIndex);
+    if (ingredientIndex >= rec.ingredientCount) {
+        throw std::out_of_range("Ingredient index out of range");
+    }
+    return ingredientsOf(rec)[ingredientIndex];
+}
+
+void BinaryCatalog::checkString(std::uint32_t offset, std::uint32_t length) const {
+    if (static_cast<std::uint64_t>(offset) + length > header->stringSize) {
+        throw std::runtime_error("Corrupt binary catalog: string out of bounds");
+    }
+}
+
+std::string BinaryCatalog::stringAt(std::uint32_t offset, std::uint32_t length) const {
+    checkString(offset, length);
+    return std::string(strings + offset, length);
+}
+
+bool BinaryCatalog::nameEquals(std::uint32_t offset, std::uint32_t length, const std::string& folded) const {
+    if (length != folded.size()) return false;
+    checkString(offset, length);
+    for (std::uint32_t i = 0; i < length; ++i) {
+        if (std::tolower(static_cast<unsigned char>(strings[offset + i])) != static_cast<unsigned char>(folded[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t BinaryCatalog::size() const {
+    return header ? header->recipeCount : 0;
+}
+
+std::string BinaryCatalog::getTitle(std::size_t index) const {
+    const Record& rec = record(index);
+    return stringAt(rec.titleOffset, rec.titleLength);
+}
+
+int BinaryCatalog::getPrepTime(std::size_t index) const {
+    return record(index).prepTime;
+}
+
+MealType BinaryCatalog::getMealType(std::size_t index) const {
+    return static_cast<MealType>(record(index).mealType);
+}
+
+DietType BinaryCatalog::getDietType(std::size_t index) const {
+    return static_cast<DietType>(record(index).dietType);
+}
+
+std::size_t BinaryCatalog::getIngredientCount(std::size_t index) const {
+    return record(index).ingredientCount;
+}
+
+std::string BinaryCatalog::getIngredientName(std::size_t index, std::size_t ingredientIndex) const {
+    const IngredientEntry& entry = ingredientEntry(index, ingredientIndex);
+    return stringAt(entry.nameOffset, entry.nameLength);
+}
+
+std::string BinaryCatalog::getIngredientQuantity(std::size_t index, std::size_t ingredientIndex) const {
+    const IngredientEntry& entry = ingredientEntry(index, ingredientIndex);
+    return stringAt(entry.quantityOffset, entry.quantityLength);
+}
+
+// --- Queries ---
+// Case-insensitive, like every other ingredient match
+std::vector<std::size_t> BinaryCatalog::findByIngredient(const std::string& name) const {
+    std::vector<std::size_t> result;
+    const std::string folded = IngredientPool::fold(name);
+    for (std::size_t i = 0; i < size(); ++i) {
+        const Record& rec = records[i];
+        const IngredientEntry* entries = ingredientsOf(rec);
+        for (std::uint32_t j = 0; j < rec.ingredientCount; ++j) {
+            const IngredientEntry& entry = entries[j];
+            if (nameEquals(entry.nameOffset, entry.nameLength, folded)) {
+                result.push_back(i);
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+// --- Materialization ---
+Recipe* BinaryCatalog::materialize(std::size_t index) const {
+    const Record& rec = record(index);
+    Recipe* recipe = RecipeManager::addRecipe(stringAt(rec.titleOffset, rec.titleLength), rec.prepTime,
+                                              static_cast<MealType>(rec.mealType),
+                                              static_cast<DietType>(rec.recipeType));
+    try {
+        const IngredientEntry* entries = ingredientsOf(rec);
+        for (std::uint32_t j = 0; j < rec.ingredientCount; ++j) {
+            const IngredientEntry& entry = entries[j];
+            recipe->addIngredient(Ingredient(stringAt(entry.nameOffset, entry.nameLength),
+                                             stringAt(entry.quantityOffset, entry.quantityLength)));
+        }
+    } catch (...) {
+        delete recipe;
+        throw;
+    }
+    return recipe;
+}
+
+LinkedList<Recipe*> BinaryCatalog::loadAll() const {
+    LinkedList<Recipe*> recipes;
+    for (std::size_t i = 0; i < size(); ++i) {
+        recipes.push_back(materialize(i));
+    }
+    return recipes;
+}
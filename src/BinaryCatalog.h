@@ -0,0 +1,117 @@
+// src/BinaryCatalog.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Recipe.h"
+#include "LinkedList.h"
+#include "MappedFile.h"
+
+// =============================
+// Binary Recipe Catalog (read-only, memory-mapped)
+// File layout (little-endian, all sections 8-byte aligned):
+//   Header            fixed 64 bytes, magic "RCPB", version, counts, offsets
+//   Record table      one fixed-width Record per recipe
+//   Ingredient table  one IngredientEntry per ingredient, grouped by recipe
+//   String table      titles, names and quantities (deduplicated)
+// The header carries a CRC-32 of itself and of everything after it, so a
+// torn or truncated file is rejected on open.
+// =============================
+
+class BinaryCatalog {
+public:
+    static const std::uint32_t FORMAT_VERSION = 1;
+
+private:
+    struct Header {
+        char magic[4];               // "RCPB"
+        std::uint32_t version;
+        std::uint32_t recipeCount;
+        std::uint32_t ingredientCount;
+        std::uint64_t recordOffset;
+        std::uint64_t ingredientOffset;
+        std::uint64_t stringOffset;
+        std::uint64_t stringSize;
+        std::uint64_t fileSize;
+        std::uint32_t bodyChecksum;   // CRC-32 of bytes [sizeof(Header), fileSize)
+        std::uint32_t headerChecksum; // CRC-32 of the header with this field zeroed
+    };
+
+    struct Record {
+        std::uint32_t titleOffset;
+        std::uint32_t titleLength;
+        std::int32_t prepTime;
+        std::uint8_t recipeType;     // DietType of the concrete Recipe subclass
+        std::uint8_t mealType;
+        std::uint8_t dietType;
+        std::uint8_t reserved;
+        std::uint32_t firstIngredient;
+        std::uint32_t ingredientCount;
+    };
+
+    struct IngredientEntry {
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        std::uint32_t quantityOffset;
+        std::uint32_t quantityLength;
+    };
+
+    static_assert(sizeof(Header) == 64, "Header layout is part of the file format");
+    static_assert(sizeof(Record) == 24, "Record layout is part of the file format");
+    static_assert(sizeof(IngredientEntry) == 16, "IngredientEntry layout is part of the file format");
+
+    MappedFile file;
+
+    const Header* header;
+    const Record* records;
+    const IngredientEntry* ingredients;
+    const char* strings;
+
+    const Record& record(std::size_t index) const;
+    const IngredientEntry* ingredientsOf(const Record& rec) const;
+    const IngredientEntry& ingredientEntry(std::size_t recipeIndex, std::size_t ingredientIndex) const;
+    void checkString(std::uint32_t offset, std::uint32_t length) const;
+    std::string stringAt(std::uint32_t offset, std::uint32_t length) const;
+    bool nameEquals(std::uint32_t offset, std::uint32_t length, const std::string& folded) const;
+
+    // Not copyable: owns the mapping
+    BinaryCatalog(const BinaryCatalog&);
+    BinaryCatalog& operator=(const BinaryCatalog&);
+
+public:
+    BinaryCatalog();
+    ~BinaryCatalog();
+
+    // Maps the file read-only and validates header, bounds and (optionally)
+    // the body checksum. Throws std::runtime_error on a bad or torn file.
+    // References inside records are checked when read, so accessors also
+    // throw std::runtime_error on a corrupt record instead of reading past
+    // the mapping.
+    void open(const std::string& filename, bool verifyChecksum = true);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    // Writes the recipes in binary format via temp file + fsync + rename, so a
+    // crash leaves the old catalog intact. Throws std::runtime_error on I/O failure.
+    static void write(const std::string& filename, const LinkedList<Recipe*>& recipes);
+
+    // Read-only queries straight from the mapping
+    std::size_t size() const;
+    std::string getTitle(std::size_t index) const;
+    int getPrepTime(std::size_t index) const;
+    MealType getMealType(std::size_t index) const;
+    DietType getDietType(std::size_t index) const;
+    std::size_t getIngredientCount(std::size_t index) const;
+    std::string getIngredientName(std::size_t index, std::size_t ingredientIndex) const;
+    std::string getIngredientQuantity(std::size_t index, std::size_t ingredientIndex) const;
+
+    // Scans without materializing recipes or allocating per record.
+    // Names match case-insensitively.
+    std::vector<std::size_t> findByIngredient(const std::string& name) const;
+
+    // Builds the full Recipe object for one record (caller owns it)
+    Recipe* materialize(std::size_t index) const;
+    LinkedList<Recipe*> loadAll() const;
+};
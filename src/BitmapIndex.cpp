@@ -0,0 +1,86 @@
+// src/BitmapIndex.cpp
+// Implementation of the meal/diet/prep-time bitmap index.
+#include "BitmapIndex.h"
+#include "Recipe.h"
+
+namespace {
+    // Bit j set where prepTimes[base + j] <= maxMinutes; 'prepTimes' holds
+    // at least base + 64 entries, so the loop has no bounds checks
+    inline std::uint64_t prepTimeMask(const std::int32_t* prepTimes, int maxMinutes) {
+        std::uint64_t mask = 0;
+        for (unsigned j = 0; j < Bitset::WORD_BITS; ++j) {
+            mask |= static_cast<std::uint64_t>(prepTimes[j] <= maxMinutes) << j;
+        }
+        return mask;
+    }
+}
+
+// --- Lookups ---
+const Bitset& BitmapIndex::withMealType(MealType type) const {
+    return mealTypes[static_cast<int>(type)];
+}
+
+const Bitset& BitmapIndex::withDietType(DietType type) const {
+    return dietTypes[static_cast<int>(type)];
+}
+
+Bitset BitmapIndex::withMaxPrepTime(int maxMinutes) const {
+    Bitset result = live;
+    std::vector<std::uint64_t>& words = result.data();
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        words[i] &= prepTimeMask(&prepTimes[i * Bitset::WORD_BITS], maxMinutes);
+    }
+    return result;
+}
+
+// Prep times are only compared for words where diet and meal left a bit
+Bitset BitmapIndex::filter(DietType diet, MealType meal, int maxMinutes) const {
+    Bitset result = withDietType(diet) & withMealType(meal);
+    if (maxMinutes >= 0) {
+        std::vector<std::uint64_t>& words = result.data();
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            if (words[i]) words[i] &= prepTimeMask(&prepTimes[i * Bitset::WORD_BITS], maxMinutes);
+        }
+    }
+    return result;
+}
+
+std::size_t BitmapIndex::bytes() const {
+    std::size_t total = live.bytes() + prepTimes.capacity() * sizeof(std::int32_t);
+    for (int i = 0; i < MEAL_TYPE_COUNT; ++i) total += mealTypes[i].bytes();
+    for (int i = 0; i < DIET_TYPE_COUNT; ++i) total += dietTypes[i].bytes();
+    return total;
+}
+
+// --- RecipeListener Hooks ---
+void BitmapIndex::onRecipeAdded(const Recipe& recipe) {
+    std::size_t id = static_cast<std::size_t>(recipe.getId());
+    if (id >= prepTimes.size()) { // Grow a whole word at a time (see prepTimeMask)
+        prepTimes.resize((id / Bitset::WORD_BITS + 1) * Bitset::WORD_BITS, 0);
+    }
+    prepTimes[id] = recipe.getPrepTime();
+    live.set(id);
+    mealTypes[static_cast<int>(recipe.getMealType())].set(id);
+    dietTypes[static_cast<int>(recipe.getDietType())].set(id);
+}
+
+void BitmapIndex::onRecipeRemoved(const Recipe& recipe) {
+    std::size_t id = static_cast<std::size_t>(recipe.getId());
+    live.reset(id);
+    mealTypes[static_cast<int>(recipe.getMealType())].reset(id);
+    dietTypes[static_cast<int>(recipe.getDietType())].reset(id);
+}
+
+void BitmapIndex::onPrepTimeChanged(const Recipe& recipe, int) {
+    prepTimes[recipe.getId()] = recipe.getPrepTime();
+}
+
+void BitmapIndex::onMealTypeChanged(const Recipe& recipe, MealType oldMealType) {
+    mealTypes[static_cast<int>(oldMealType)].reset(recipe.getId());
+    mealTypes[static_cast<int>(recipe.getMealType())].set(recipe.getId());
+}
+
+void BitmapIndex::onDietTypeChanged(const Recipe& recipe, DietType oldDietType) {
+    dietTypes[static_cast<int>(oldDietType)].reset(recipe.getId());
+    dietTypes[static_cast<int>(recipe.getDietType())].set(recipe.getId());
+}
@@ -0,0 +1,47 @@
+// src/BitmapIndex.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "RecipeListener.h"
+#include "Bitset.h"
+
+const int MEAL_TYPE_COUNT = static_cast<int>(MealType::Other) + 1;
+const int DIET_TYPE_COUNT = static_cast<int>(DietType::Other) + 1;
+
+// =============================
+// Bitmap Index for low-cardinality filters
+// - One bitset of recipe ids per MealType and per DietType value, plus the
+//   live set; combined filters are word-wide ANDs
+// - Prep-time limits become a bitset built 64 ids per word from a packed
+//   prep-time column, so "Vegan AND Breakfast AND prepTime<=15" is three
+//   bitsets ANDed together
+// - Maintained incrementally as a RecipeStore listener
+// =============================
+
+class BitmapIndex : public RecipeListener {
+private:
+    Bitset live;
+    Bitset mealTypes[MEAL_TYPE_COUNT];
+    Bitset dietTypes[DIET_TYPE_COUNT];
+    std::vector<std::int32_t> prepTimes; // By RecipeId (only read where 'live' is set)
+
+public:
+    const Bitset& all() const { return live; }
+    const Bitset& withMealType(MealType type) const;
+    const Bitset& withDietType(DietType type) const;
+    Bitset withMaxPrepTime(int maxMinutes) const;
+
+    // Recipes matching every given filter; a negative maxMinutes means no limit
+    Bitset filter(DietType diet, MealType meal, int maxMinutes = -1) const;
+
+    int size() const { return static_cast<int>(live.count()); }
+    std::size_t bytes() const; // Heap held by the bitsets and prep-time column
+
+    // RecipeListener hooks
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onPrepTimeChanged(const Recipe& recipe, int oldPrepTime) override;
+    void onMealTypeChanged(const Recipe& recipe, MealType oldMealType) override;
+    void onDietTypeChanged(const Recipe& recipe, DietType oldDietType) override;
+};
@@ -0,0 +1,133 @@
+// src/Bitset.cpp
+// Word-at-a-time bitset operations.
+#include "Bitset.h"
+#include <algorithm> // For std::min
+
+namespace {
+    inline unsigned popcount64(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<unsigned>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    inline unsigned lowestBit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+        return popcount64((word & (0 - word)) - 1);
+#endif
+    }
+}
+
+// --- Single Bits ---
+void Bitset::set(std::size_t bit) {
+    std::size_t word = bit / WORD_BITS;
+    if (word >= words.size()) {
+        words.resize(word + 1, 0);
+    }
+    words[word] |= std::uint64_t(1) << (bit % WORD_BITS);
+}
+
+void Bitset::reset(std::size_t bit) {
+    std::size_t word = bit / WORD_BITS;
+    if (word < words.size()) {
+        words[word] &= ~(std::uint64_t(1) << (bit % WORD_BITS));
+    }
+}
+
+bool Bitset::test(std::size_t bit) const {
+    std::size_t word = bit / WORD_BITS;
+    return word < words.size() && (words[word] >> (bit % WORD_BITS)) & 1;
+}
+
+// --- Set Operations ---
+Bitset& Bitset::operator&=(const Bitset& other) {
+    const std::size_t n = std::min(words.size(), other.words.size());
+    std::uint64_t* a = words.data();
+    const std::uint64_t* b = other.words.data();
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] &= b[i];
+    }
+    words.resize(n); // Beyond 'other' everything is zero
+    return *this;
+}
+
+Bitset& Bitset::operator|=(const Bitset& other) {
+    if (other.words.size() > words.size()) {
+        words.resize(other.words.size(), 0);
+    }
+    std::uint64_t* a = words.data();
+    const std::uint64_t* b = other.words.data();
+    const std::size_t n = other.words.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] |= b[i];
+    }
+    return *this;
+}
+
+Bitset& Bitset::andNot(const Bitset& other) {
+    std::uint64_t* a = words.data();
+    const std::uint64_t* b = other.words.data();
+    const std::size_t n = std::min(words.size(), other.words.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] &= ~b[i];
+    }
+    return *this;
+}
+
+// --- Counting ---
+std::size_t Bitset::count() const {
+    const std::uint64_t* a = words.data();
+    const std::size_t n = words.size();
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        total += popcount64(a[i]);
+    }
+    return total;
+}
+
+bool Bitset::none() const {
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        if (words[i]) return false;
+    }
+    return true;
+}
+
+std::size_t Bitset::countAnd(const Bitset& a, const Bitset& b) {
+    const std::uint64_t* x = a.words.data();
+    const std::uint64_t* y = b.words.data();
+    const std::size_t n = std::min(a.words.size(), b.words.size());
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        total += popcount64(x[i] & y[i]);
+    }
+    return total;
+}
+
+// --- Conversion ---
+PostingList Bitset::toPostingList() const {
+    PostingList ids;
+    ids.reserve(count());
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        for (std::uint64_t word = words[i]; word; word &= word - 1) { // Clear the lowest bit
+            ids.push_back(static_cast<RecipeId>(i * WORD_BITS + lowestBit(word)));
+        }
+    }
+    return ids;
+}
+
+Bitset Bitset::fromPostingList(const PostingList& ids) {
+    Bitset bits;
+    if (!ids.empty() && ids.back() >= 0) {
+        bits.words.resize(static_cast<std::size_t>(ids.back()) / WORD_BITS + 1, 0);
+    }
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (ids[i] >= 0) bits.set(static_cast<std::size_t>(ids[i]));
+    }
+    return bits;
+}
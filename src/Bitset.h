@@ -0,0 +1,50 @@
+// src/Bitset.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PostingList.h"
+
+// =============================
+// Growable Bitset over recipe ids
+// - 64 ids per word; missing trailing words read as zero, so sets of
+//   different lengths combine without resizing the shorter one
+// - AND / OR / AND NOT run one word at a time and count() is a popcount
+//   loop; both auto-vectorize (build with -mpopcnt or -march=native to
+//   get the hardware popcount instruction)
+// =============================
+
+class Bitset {
+private:
+    std::vector<std::uint64_t> words;
+
+public:
+    static const std::size_t WORD_BITS = 64;
+
+    Bitset() {}
+
+    void set(std::size_t bit);
+    void reset(std::size_t bit);
+    bool test(std::size_t bit) const;
+    void clear() { words.clear(); }
+
+    Bitset& operator&=(const Bitset& other);
+    Bitset& operator|=(const Bitset& other);
+    Bitset& andNot(const Bitset& other);  // Clears every bit set in 'other'
+
+    std::size_t count() const;            // Set bits
+    bool none() const;
+    static std::size_t countAnd(const Bitset& a, const Bitset& b); // Without building a & b
+
+    PostingList toPostingList() const;    // Set bits as sorted ids
+    static Bitset fromPostingList(const PostingList& ids);
+
+    // Raw word access for builders that fill 64 bits at a time
+    std::vector<std::uint64_t>& data() { return words; }
+    const std::vector<std::uint64_t>& data() const { return words; }
+    std::size_t bytes() const { return words.capacity() * sizeof(std::uint64_t); }
+};
+
+inline Bitset operator&(Bitset a, const Bitset& b) { return a &= b; }
+inline Bitset operator|(Bitset a, const Bitset& b) { return a |= b; }
@@ -0,0 +1,29 @@
+// src/Checksum.cpp
+// Table-driven CRC-32.
+#include "Checksum.h"
+
+namespace {
+    // Lookup table for the reflected polynomial 0xEDB88320
+    struct CrcTable {
+        std::uint32_t entries[256];
+        CrcTable() {
+            for (std::uint32_t i = 0; i < 256; ++i) {
+                std::uint32_t value = i;
+                for (int bit = 0; bit < 8; ++bit) {
+                    value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+                }
+                entries[i] = value;
+            }
+        }
+    };
+}
+
+std::uint32_t crc32(const void* data, std::size_t length, std::uint32_t crc) {
+    static const CrcTable table; // Initialized once, thread-safe in C++11
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+    for (std::size_t i = 0; i < length; ++i) {
+        crc = table.entries[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
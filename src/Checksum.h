@@ -0,0 +1,9 @@
+// src/Checksum.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// CRC-32 (IEEE 802.3 polynomial) used to detect torn or corrupted files.
+// Pass the previous result as 'crc' to checksum data in pieces.
+std::uint32_t crc32(const void* data, std::size_t length, std::uint32_t crc = 0);
@@ -1,4 +1,6 @@
 // src/DietType.h
+#pragma once
+
 // Defines the DietType enum to categorize recipes by dietary restriction.
 
 enum class DietType {
@@ -0,0 +1,88 @@
+// src/FileSync.cpp
+// fsync helpers for crash-safe writes (no-ops where unsupported) and the
+// temp-file + rename writer built on them.
+#include "FileSync.h"
+#include <stdexcept>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>  // For fsync
+#endif
+
+bool syncFile(std::FILE* file) {
+    if (std::fflush(file) != 0) return false;
+#ifndef _WIN32
+    return fsync(fileno(file)) == 0;
+#else
+    return true;
+#endif
+}
+
+void syncParentDirectory(const std::string& filename) {
+#ifndef _WIN32
+    std::string::size_type slash = filename.find_last_of('/');
+    std::string directory = slash == std::string::npos ? "." : filename.substr(0, slash + 1);
+    int fd = ::open(directory.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        ::close(fd);
+    }
+#else
+    (void)filename;
+#endif
+}
+
+// --- BlockFile ---
+BlockFile::BlockFile(const std::string& filename, std::size_t blockSize)
+    : filename(filename), tempFile(filename + ".tmp"), blockSize(blockSize), failed(false) {
+    file = std::fopen(tempFile.c_str(), "wb");
+    if (!file) {
+        throw std::runtime_error("Could not create " + tempFile);
+    }
+    std::setvbuf(file, nullptr, _IONBF, 0); // Blocks are already large
+    block.reserve(blockSize);
+}
+
+BlockFile::~BlockFile() {
+    if (file) { // commit() never ran: discard the partial temp file
+        std::fclose(file);
+        std::remove(tempFile.c_str());
+    }
+}
+
+void BlockFile::flushBlock() {
+    if (!block.empty() && std::fwrite(block.data(), 1, block.size(), file) != block.size()) {
+        failed = true;
+    }
+    block.clear();
+}
+
+void BlockFile::append(const void* data, std::size_t size) {
+    block.append(static_cast<const char*>(data), size);
+    if (block.size() >= blockSize) {
+        flushBlock();
+    }
+}
+
+void BlockFile::appendLine(const std::string& line) {
+    block.append(line);
+    endLine();
+}
+
+void BlockFile::endLine() {
+    block.push_back('\n');
+    if (block.size() >= blockSize) {
+        flushBlock();
+    }
+}
+
+void BlockFile::commit() {
+    flushBlock();
+    bool ok = !failed && syncFile(file);
+    ok = std::fclose(file) == 0 && ok;
+    file = nullptr;
+    if (!ok || std::rename(tempFile.c_str(), filename.c_str()) != 0) {
+        std::remove(tempFile.c_str());
+        throw std::runtime_error("Could not write " + filename);
+    }
+    syncParentDirectory(filename);
+}
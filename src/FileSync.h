@@ -0,0 +1,45 @@
+// src/FileSync.h
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+// Flushes stdio buffers and asks the OS to put the bytes on disk.
+bool syncFile(std::FILE* file);
+
+// Makes a create or rename inside the file's directory durable.
+void syncParentDirectory(const std::string& filename);
+
+// Accumulates output into blocks of 'blockSize' bytes and writes them to
+// "<file>.tmp", which is fsynced and renamed over the target on commit().
+// Destroyed without commit(), it removes the temp file and the target is
+// untouched. Throws std::runtime_error on failure.
+class BlockFile {
+private:
+    std::string filename;
+    std::string tempFile;
+    std::FILE* file;
+    std::string block;
+    std::size_t blockSize;
+    bool failed;
+
+    void flushBlock();
+
+    // Not copyable: owns the open file
+    BlockFile(const BlockFile&);
+    BlockFile& operator=(const BlockFile&);
+
+public:
+    BlockFile(const std::string& filename, std::size_t blockSize);
+    ~BlockFile();
+
+    void append(const void* data, std::size_t size);
+    void appendLine(const std::string& line);
+
+    // For writers that serialize straight into the block, then call endLine()
+    std::string& buffer() { return block; }
+    void endLine();
+
+    void commit();
+};
@@ -0,0 +1,400 @@
+// src/FuzzySearch.cpp
+// Trigram candidate generation and bounded edit-distance verification.
+#include "FuzzySearch.h"
+#include "IngredientIndex.h"
+#include "TitleIndex.h" // For TitleIndex::fold
+#include "Recipe.h"
+#include <algorithm> // For std::sort, std::min
+#include <cctype>
+#include <cstdlib>   // For std::abs
+
+// --- Edit Distance ---
+int damerauDistance(const std::string& a, const std::string& b, int maxDistance) {
+    const int n = static_cast<int>(a.size());
+    const int m = static_cast<int>(b.size());
+    if (std::abs(n - m) > maxDistance) return maxDistance + 1;
+    if (n == 0 || m == 0) return std::max(n, m);
+
+    std::vector<int> beforePrevious(m + 1), previous(m + 1), current(m + 1);
+    for (int j = 0; j <= m; ++j) previous[j] = j;
+
+    for (int i = 1; i <= n; ++i) {
+        current[0] = i;
+        int rowMin = i;
+        for (int j = 1; j <= m; ++j) {
+            int cost = (a[i - 1] == b[j - 1]) ? 0 : 1;
+            int value = std::min(std::min(previous[j] + 1, current[j - 1] + 1), previous[j - 1] + cost);
+            if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1]) {
+                value = std::min(value, beforePrevious[j - 2] + 1);
+            }
+            current[j] = value;
+            rowMin = std::min(rowMin, value);
+        }
+        // A later row never drops below this row's minimum (a transposition
+        // two rows down costs at least as much as the diagonal through here)
+        if (rowMin > maxDistance) return maxDistance + 1;
+        beforePrevious.swap(previous);
+        previous.swap(current);
+    }
+    return std::min(previous[m], maxDistance + 1);
+}
+
+int defaultMaxDistance(std::size_t length) {
+    if (length <= 2) return 0;
+    return length <= 5 ? 1 : 2;
+}
+
+namespace {
+    // Distinct trigrams of the term padded with two markers on each side,
+    // so short terms and word edges get trigrams of their own
+    std::vector<std::uint32_t> paddedTrigrams(const std::string& term) {
+        const std::string padded = std::string(2, '\1') + term + std::string(2, '\1');
+        std::vector<std::uint32_t> keys;
+        for (std::size_t i = 0; i + 3 <= padded.size(); ++i) {
+            keys.push_back(static_cast<std::uint32_t>(static_cast<unsigned char>(padded[i])) << 16 |
+                           static_cast<std::uint32_t>(static_cast<unsigned char>(padded[i + 1])) << 8 |
+                           static_cast<std::uint32_t>(static_cast<unsigned char>(padded[i + 2])));
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        return keys;
+    }
+
+    // Which bytes occur in the term, folded onto 64 bits (letters and
+    // digits get their own). Each edit can drop at most one of the query's
+    // bits from a term, so more than maxDistance missing bits either way
+    // rules the term out without computing the distance.
+    std::uint64_t byteMask(const std::string& term) {
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < term.size(); ++i) {
+            unsigned char c = static_cast<unsigned char>(term[i]);
+            unsigned bit = (c >= 'a' && c <= 'z') ? c - 'a' : (c >= '0' && c <= '9') ? 26 + (c - '0') : 36 + c % 28;
+            mask |= std::uint64_t(1) << bit;
+        }
+        return mask;
+    }
+
+    int bitCount(std::uint64_t bits) {
+        int count = 0;
+        for (; bits; bits &= bits - 1) ++count;
+        return count;
+    }
+
+    bool closerMatch(const FuzzyMatcher::Match& a, const FuzzyMatcher::Match& b) {
+        return a.distance < b.distance || (a.distance == b.distance && a.term < b.term);
+    }
+
+    bool hitIdLess(const FuzzyHit& a, const FuzzyHit& b) {
+        return a.id < b.id || (a.id == b.id && a.distance < b.distance);
+    }
+
+    bool hitRankLess(const FuzzyHit& a, const FuzzyHit& b) {
+        return a.distance < b.distance || (a.distance == b.distance && a.id < b.id);
+    }
+
+    // Sorts by id and keeps each recipe's best distance
+    void bestPerRecipe(std::vector<FuzzyHit>& hits) {
+        std::sort(hits.begin(), hits.end(), hitIdLess);
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < hits.size(); ++i) {
+            if (kept == 0 || hits[kept - 1].id != hits[i].id) hits[kept++] = hits[i];
+        }
+        hits.resize(kept);
+    }
+
+    void keepTop(std::vector<FuzzyHit>& hits, std::size_t k) {
+        if (hits.size() > k) {
+            std::partial_sort(hits.begin(), hits.begin() + k, hits.end(), hitRankLess);
+            hits.resize(k);
+        } else {
+            std::sort(hits.begin(), hits.end(), hitRankLess);
+        }
+    }
+
+    // Recipes of one matched term
+    struct TermPostings {
+        const PostingList* ids;
+        int distance;
+    };
+
+    // Every recipe of the terms with its best distance, in id order. The
+    // posting lists are sorted, so each term is one linear merge.
+    std::vector<FuzzyHit> allHits(const std::vector<TermPostings>& terms) {
+        std::vector<FuzzyHit> hits;
+        std::vector<FuzzyHit> merged;
+        for (std::size_t t = 0; t < terms.size(); ++t) {
+            const PostingList& ids = *terms[t].ids;
+            const int distance = terms[t].distance;
+            merged.clear();
+            merged.reserve(hits.size() + ids.size());
+            std::size_t i = 0, j = 0;
+            while (i < hits.size() || j < ids.size()) {
+                if (j == ids.size() || (i < hits.size() && hits[i].id < ids[j])) {
+                    merged.push_back(hits[i++]);
+                } else if (i == hits.size() || ids[j] < hits[i].id) {
+                    FuzzyHit hit = { ids[j++], distance };
+                    merged.push_back(hit);
+                } else { // Terms come closest first: keep the earlier distance
+                    merged.push_back(hits[i++]);
+                    ++j;
+                }
+            }
+            hits.swap(merged);
+        }
+        return hits;
+    }
+
+    // Top k of allHits() without visiting every posting. Terms come closest
+    // first, so tiers of equal distance are filled in order. When 'taken'
+    // ids are already in the result, the smallest r new ids of a tier all
+    // sit within the first r + taken entries of some list in that tier.
+    std::vector<FuzzyHit> topHits(const std::vector<TermPostings>& terms, std::size_t k) {
+        std::vector<FuzzyHit> result;
+        PostingList taken; // Sorted ids already in 'result'
+        for (std::size_t tier = 0; tier < terms.size() && result.size() < k;) {
+            std::size_t tierEnd = tier;
+            while (tierEnd < terms.size() && terms[tierEnd].distance == terms[tier].distance) ++tierEnd;
+
+            const std::size_t wanted = k - result.size();
+            PostingList candidates;
+            for (std::size_t t = tier; t < tierEnd; ++t) {
+                const PostingList& ids = *terms[t].ids;
+                std::size_t prefix = std::min(ids.size(), wanted + taken.size());
+                candidates.insert(candidates.end(), ids.begin(), ids.begin() + prefix);
+            }
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+            candidates = subtractPostings(candidates, taken);
+            if (candidates.size() > wanted) candidates.resize(wanted);
+
+            for (std::size_t i = 0; i < candidates.size(); ++i) {
+                FuzzyHit hit = { candidates[i], terms[tier].distance };
+                result.push_back(hit);
+                insertPosting(taken, candidates[i]);
+            }
+            tier = tierEnd;
+        }
+        return result;
+    }
+
+    // Runs of letters and digits
+    std::vector<std::string> splitWords(const std::string& text) {
+        std::vector<std::string> words;
+        std::string word;
+        for (std::size_t i = 0; i <= text.size(); ++i) {
+            if (i < text.size() && std::isalnum(static_cast<unsigned char>(text[i]))) {
+                word.push_back(text[i]);
+            } else if (!word.empty()) {
+                words.push_back(word);
+                word.clear();
+            }
+        }
+        return words;
+    }
+
+    std::string trimmed(const std::string& text) {
+        std::size_t first = text.find_first_not_of(" \t");
+        if (first == std::string::npos) return "";
+        std::size_t last = text.find_last_not_of(" \t");
+        return text.substr(first, last - first + 1);
+    }
+}
+
+// --- FuzzyMatcher ---
+std::uint32_t FuzzyMatcher::add(const std::string& term) {
+    std::unordered_map<std::string, std::uint32_t>::const_iterator known = ids.find(term);
+    if (known != ids.end()) {
+        return known->second;
+    }
+    std::uint32_t id = static_cast<std::uint32_t>(terms.size());
+    terms.push_back(term);
+    ids[term] = id;
+    std::vector<std::uint32_t> keys = paddedTrigrams(term);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        grams[keys[i]].push_back(id);
+    }
+    if (term.size() >= byLength.size()) byLength.resize(term.size() + 1);
+    byLength[term.size()].push_back(id);
+    masks.push_back(byteMask(term));
+    return id;
+}
+
+std::vector<FuzzyMatcher::Match> FuzzyMatcher::find(const std::string& query, int maxDistance, std::size_t limit) const {
+    std::vector<Match> matches;
+    const std::vector<std::uint32_t> keys = paddedTrigrams(query);
+    const int threshold = static_cast<int>(keys.size()) - 4 * maxDistance;
+
+    // Candidates: terms sharing enough trigrams, or every term of a close
+    // enough length when the query is too short for the trigram bound to
+    // rule anything out (or those length buckets are smaller than the
+    // trigram lists to count)
+    std::vector<const std::vector<std::uint32_t>*> lists;
+    std::size_t gramPostings = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        std::unordered_map<std::uint32_t, std::vector<std::uint32_t> >::const_iterator gram = grams.find(keys[i]);
+        if (gram == grams.end()) continue;
+        lists.push_back(&gram->second);
+        gramPostings += gram->second.size();
+    }
+    const std::size_t shortest = query.size() > static_cast<std::size_t>(maxDistance) ? query.size() - maxDistance : 0;
+    const std::size_t longest = std::min(query.size() + maxDistance + 1, byLength.size());
+    std::size_t lengthPostings = 0;
+    for (std::size_t length = shortest; length < longest; ++length) {
+        lengthPostings += byLength[length].size();
+    }
+
+    std::vector<std::uint32_t> candidates;
+    if (threshold <= 0 || lengthPostings <= gramPostings) {
+        for (std::size_t length = shortest; length < longest; ++length) {
+            candidates.insert(candidates.end(), byLength[length].begin(), byLength[length].end());
+        }
+    } else {
+        std::vector<std::uint16_t> shared(terms.size(), 0);
+        std::vector<std::uint32_t> touched;
+        for (std::size_t i = 0; i < lists.size(); ++i) {
+            const std::vector<std::uint32_t>& list = *lists[i];
+            for (std::size_t j = 0; j < list.size(); ++j) {
+                if (shared[list[j]]++ == 0) touched.push_back(list[j]);
+            }
+        }
+        for (std::size_t i = 0; i < touched.size(); ++i) {
+            if (shared[touched[i]] >= threshold) candidates.push_back(touched[i]);
+        }
+    }
+
+    const std::uint64_t queryMask = byteMask(query);
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        const std::string& term = terms[candidates[i]];
+        int lengthGap = static_cast<int>(term.size()) - static_cast<int>(query.size());
+        if (lengthGap > maxDistance || -lengthGap > maxDistance) continue;
+        const std::uint64_t termMask = masks[candidates[i]];
+        if (bitCount(queryMask & ~termMask) > maxDistance || bitCount(termMask & ~queryMask) > maxDistance) continue;
+        int distance = damerauDistance(query, term, maxDistance);
+        if (distance <= maxDistance) {
+            Match match = { candidates[i], distance };
+            matches.push_back(match);
+        }
+    }
+
+    std::sort(matches.begin(), matches.end(), closerMatch);
+    if (matches.size() > limit) matches.resize(limit);
+    return matches;
+}
+
+// --- FuzzySearch ---
+void FuzzySearch::indexTitle(RecipeId id, const std::string& title) {
+    std::vector<std::string> words = splitWords(TitleIndex::fold(title));
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        std::uint32_t term = titleWords.add(words[i]);
+        if (term >= wordPostings.size()) wordPostings.resize(term + 1);
+        insertPosting(wordPostings[term], id);
+    }
+}
+
+void FuzzySearch::unindexTitle(RecipeId id, const std::string& title) {
+    std::vector<std::string> words = splitWords(TitleIndex::fold(title));
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        erasePosting(wordPostings[titleWords.add(words[i])], id);
+    }
+}
+
+void FuzzySearch::addIngredient(IngredientId id) {
+    std::uint32_t term = ingredientNames.add(IngredientPool::instance().folded(id));
+    if (term == ingredientIds.size()) {
+        ingredientIds.push_back(id);
+    }
+}
+
+std::vector<FuzzyHit> FuzzySearch::searchTitles(const std::string& query, std::size_t k) const {
+    std::vector<std::string> words = splitWords(TitleIndex::fold(query));
+    std::vector<std::vector<TermPostings> > perWord;
+    for (std::size_t w = 0; w < words.size(); ++w) {
+        std::vector<FuzzyMatcher::Match> matches =
+            titleWords.find(words[w], defaultMaxDistance(words[w].size()), MAX_TERMS);
+        std::vector<TermPostings> terms;
+        for (std::size_t i = 0; i < matches.size(); ++i) {
+            TermPostings term = { &wordPostings[matches[i].term], matches[i].distance };
+            if (!term.ids->empty()) terms.push_back(term);
+        }
+        if (terms.empty()) {
+            return std::vector<FuzzyHit>(); // Every word must match
+        }
+        perWord.push_back(terms);
+    }
+    if (perWord.empty()) {
+        return std::vector<FuzzyHit>();
+    }
+    if (perWord.size() == 1) {
+        return topHits(perWord[0], k);
+    }
+
+    // Intersect the words by id, adding their distances
+    std::vector<FuzzyHit> result = allHits(perWord[0]);
+    for (std::size_t w = 1; w < perWord.size() && !result.empty(); ++w) {
+        std::vector<FuzzyHit> hits = allHits(perWord[w]);
+        std::vector<FuzzyHit> both;
+        std::size_t i = 0, j = 0;
+        while (i < result.size() && j < hits.size()) {
+            if (result[i].id < hits[j].id) {
+                ++i;
+            } else if (hits[j].id < result[i].id) {
+                ++j;
+            } else {
+                FuzzyHit hit = { result[i].id, result[i].distance + hits[j].distance };
+                both.push_back(hit);
+                ++i;
+                ++j;
+            }
+        }
+        result.swap(both);
+    }
+    keepTop(result, k);
+    return result;
+}
+
+std::vector<FuzzyHit> FuzzySearch::searchIngredients(const std::string& query, std::size_t k) const {
+    const std::string name = TitleIndex::fold(trimmed(query));
+    if (name.empty()) {
+        return std::vector<FuzzyHit>();
+    }
+    std::vector<FuzzyMatcher::Match> matches =
+        ingredientNames.find(name, defaultMaxDistance(name.size()), MAX_TERMS);
+
+    std::vector<TermPostings> terms;
+    for (std::size_t i = 0; i < matches.size(); ++i) {
+        TermPostings term = { ingredientIndex.find(ingredientIds[matches[i].term]), matches[i].distance };
+        if (term.ids && !term.ids->empty()) terms.push_back(term);
+    }
+    return topHits(terms, k);
+}
+
+std::vector<FuzzyHit> FuzzySearch::search(const std::string& query, std::size_t k) const {
+    std::vector<FuzzyHit> hits = searchTitles(query, k);
+    std::vector<FuzzyHit> byIngredient = searchIngredients(query, k);
+    hits.insert(hits.end(), byIngredient.begin(), byIngredient.end());
+    bestPerRecipe(hits);
+    keepTop(hits, k);
+    return hits;
+}
+
+// --- RecipeListener Hooks ---
+void FuzzySearch::onRecipeAdded(const Recipe& recipe) {
+    indexTitle(recipe.getId(), recipe.getTitle());
+    const IngredientList& ingredients = recipe.getIngredients();
+    for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+        addIngredient(it->getId());
+    }
+}
+
+void FuzzySearch::onRecipeRemoved(const Recipe& recipe) {
+    unindexTitle(recipe.getId(), recipe.getTitle());
+}
+
+void FuzzySearch::onTitleChanged(const Recipe& recipe, const std::string& oldTitle) {
+    unindexTitle(recipe.getId(), oldTitle);
+    indexTitle(recipe.getId(), recipe.getTitle());
+}
+
+void FuzzySearch::onIngredientAdded(const Recipe&, const Ingredient& ingredient) {
+    addIngredient(ingredient.getId());
+}
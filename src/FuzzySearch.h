@@ -0,0 +1,104 @@
+// src/FuzzySearch.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "RecipeListener.h"
+#include "PostingList.h"
+#include "IngredientPool.h"
+
+class IngredientIndex;
+
+// Optimal-string-alignment (Damerau) distance: insertions, deletions,
+// substitutions and adjacent transpositions cost 1. Stops early and
+// returns maxDistance + 1 once the distance must exceed maxDistance.
+int damerauDistance(const std::string& a, const std::string& b, int maxDistance);
+
+// Typo budget for a query word: 0 up to 2 bytes, 1 up to 5, then 2
+int defaultMaxDistance(std::size_t length);
+
+// =============================
+// Fuzzy Term Matcher
+// - A vocabulary of distinct folded terms with a padded-trigram index
+// - find() counts shared trigrams per term, keeps terms that share enough
+//   to possibly be within the distance (each edit breaks at most four
+//   trigrams), then verifies them with the bounded distance. When the
+//   query is too short for that bound, only terms of a length within the
+//   distance are verified
+// - Terms are only ever added; ids are positions in the vocabulary
+// =============================
+
+class FuzzyMatcher {
+public:
+    struct Match {
+        std::uint32_t term;
+        int distance;
+    };
+
+    std::uint32_t add(const std::string& term);  // Returns the existing id if known
+    const std::string& term(std::uint32_t id) const { return terms[id]; }
+    std::size_t size() const { return terms.size(); }
+
+    // Terms within maxDistance of 'query' (folded), closest first, at most 'limit'
+    std::vector<Match> find(const std::string& query, int maxDistance, std::size_t limit) const;
+
+private:
+    std::vector<std::string> terms;
+    std::unordered_map<std::string, std::uint32_t> ids;
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t> > grams; // Trigram -> term ids
+    std::vector<std::vector<std::uint32_t> > byLength; // Term ids by length in bytes
+    std::vector<std::uint64_t> masks; // Bytes occurring in each term, by term id
+};
+
+// One ranked recipe; 'distance' is the total typo count of the match
+struct FuzzyHit {
+    RecipeId id;
+    int distance;
+};
+
+// =============================
+// Fuzzy Recipe Search
+// - Title queries: each query word is matched against the words of all
+//   titles; a recipe must match every query word and ranks by the summed
+//   distance
+// - Ingredient queries: the whole query is matched against ingredient
+//   names, then mapped to recipes through the IngredientIndex
+// - Results are the top k by (distance, id). Single-term queries merge
+//   posting lists closest term first and stop once k recipes are found
+// - Kept current as a RecipeStore listener (the vocabulary only grows; a
+//   term no recipe uses any more simply has an empty posting list)
+// =============================
+
+class FuzzySearch : public RecipeListener {
+private:
+    const IngredientIndex& ingredientIndex;
+    FuzzyMatcher titleWords;
+    std::vector<PostingList> wordPostings;   // Recipes by titleWords term id
+    FuzzyMatcher ingredientNames;
+    std::vector<IngredientId> ingredientIds; // By ingredientNames term id
+
+    void indexTitle(RecipeId id, const std::string& title);
+    void unindexTitle(RecipeId id, const std::string& title);
+    void addIngredient(IngredientId id);
+
+public:
+    // Candidate terms considered per query word
+    static const std::size_t MAX_TERMS = 32;
+
+    explicit FuzzySearch(const IngredientIndex& ingredientIndex) : ingredientIndex(ingredientIndex) {}
+
+    std::vector<FuzzyHit> searchTitles(const std::string& query, std::size_t k = 10) const;
+    std::vector<FuzzyHit> searchIngredients(const std::string& query, std::size_t k = 10) const;
+    std::vector<FuzzyHit> search(const std::string& query, std::size_t k = 10) const; // Best of both
+
+    std::size_t vocabularySize() const { return titleWords.size() + ingredientNames.size(); }
+
+    // RecipeListener hooks
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onTitleChanged(const Recipe& recipe, const std::string& oldTitle) override;
+    void onIngredientAdded(const Recipe& recipe, const Ingredient& ingredient) override;
+};
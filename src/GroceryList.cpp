@@ -0,0 +1,75 @@
+// src/GroceryList.cpp
+// Hash aggregation of meal plans into shopping lists.
+#include "GroceryList.h"
+#include "ThreadPool.h"
+#include <algorithm> // For std::sort
+#include <unordered_map>
+
+// --- Grocery Items ---
+std::string GroceryItem::getName() const {
+    return IngredientPool::instance().folded(ingredient);
+}
+
+std::string GroceryItem::toString() const {
+    std::string text = getName() + ": ";
+    std::string amounts = total.toString();
+    if (amounts.empty()) {
+        return text + "as needed"; // No quantity given at all
+    }
+    return text + amounts;
+}
+
+static bool groceryNameLess(const GroceryItem& a, const GroceryItem& b) {
+    const IngredientPool& pool = IngredientPool::instance();
+    return pool.folded(a.ingredient) < pool.folded(b.ingredient);
+}
+
+// --- Builder ---
+GroceryList GroceryListBuilder::build(const MealPlan& plan) const {
+    GroceryList items;
+    std::unordered_map<IngredientId, std::size_t> slots; // Ingredient -> index in items
+    slots.reserve(plan.size() * 8);
+
+    for (std::size_t i = 0; i < plan.size(); ++i) {
+        const Recipe* recipe = store.get(plan[i]);
+        if (!recipe) continue;
+        const IngredientList& ingredients = recipe->getIngredients();
+        for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+            std::pair<std::unordered_map<IngredientId, std::size_t>::iterator, bool> slot =
+                slots.insert(std::make_pair(it->getId(), items.size()));
+            if (slot.second) {
+                GroceryItem item;
+                item.ingredient = it->getId();
+                items.push_back(item);
+            }
+            items[slot.first->second].total.add(it->getParsedQuantity(), it->getQuantity());
+        }
+    }
+
+    std::sort(items.begin(), items.end(), groceryNameLess);
+    return items;
+}
+
+std::vector<GroceryList> GroceryListBuilder::buildAll(const std::vector<MealPlan>& plans, ThreadPool* pool) const {
+    std::vector<GroceryList> lists(plans.size());
+    if (!pool || plans.size() < 2) {
+        for (std::size_t i = 0; i < plans.size(); ++i) {
+            lists[i] = build(plans[i]);
+        }
+        return lists;
+    }
+
+    // A few batches per worker keeps the threads busy when plan sizes vary
+    std::size_t batches = std::min<std::size_t>(plans.size(), pool->size() * 4);
+    std::size_t perBatch = (plans.size() + batches - 1) / batches;
+    for (std::size_t begin = 0; begin < plans.size(); begin += perBatch) {
+        std::size_t end = std::min(plans.size(), begin + perBatch);
+        pool->submit([this, &plans, &lists, begin, end]() {
+            for (std::size_t i = begin; i < end; ++i) {
+                lists[i] = build(plans[i]);
+            }
+        });
+    }
+    pool->wait();
+    return lists;
+}
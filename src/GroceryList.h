@@ -0,0 +1,47 @@
+// src/GroceryList.h
+#pragma once
+
+#include <string>
+#include <vector>
+#include "RecipeStore.h"
+#include "Quantity.h"
+
+class ThreadPool;
+
+// A meal plan is the recipes to cook; a recipe listed twice is cooked twice
+typedef std::vector<RecipeId> MealPlan;
+
+// One line of a shopping list
+struct GroceryItem {
+    IngredientId ingredient;
+    QuantityTotals total;   // Grams, millilitres and counts summed over the plan, plus unparsed texts
+
+    std::string getName() const; // Case-folded ingredient name
+    std::string toString() const; // e.g. "garlic: 3 clove + 1 head"
+};
+
+typedef std::vector<GroceryItem> GroceryList;
+
+// =============================
+// Grocery List Builder
+// - Merges the ingredients of every recipe in a plan into one list,
+//   hash-aggregated on interned ingredient ids
+// - Quantities come pre-parsed from each Ingredient, so merging never
+//   touches the quantity text; mass and volume are normalized to g / ml
+// - buildAll() spreads a batch of plans over a ThreadPool; the store and
+//   recipes are only read, so they must not change during the batch
+// - Lists are ordered by ingredient name; removed recipe ids are ignored
+// =============================
+
+class GroceryListBuilder {
+private:
+    const RecipeStore& store;
+
+public:
+    explicit GroceryListBuilder(const RecipeStore& store) : store(store) {}
+
+    GroceryList build(const MealPlan& plan) const;
+
+    // One list per plan, in plan order. Runs on 'pool' when given.
+    std::vector<GroceryList> buildAll(const std::vector<MealPlan>& plans, ThreadPool* pool = nullptr) const;
+};
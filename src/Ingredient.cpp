@@ -1,30 +1,48 @@
 // src/Ingredient.cpp
 #include "Ingredient.h"
 #include <sstream>
+#include <stdexcept> // For std::invalid_argument
 
 Ingredient::Ingredient(const std::string& name, const std::string& quantity) {
-    this->name = name;
-    this->quantity = quantity;
+    setName(name);
+    setQuantity(quantity);
 }
 
-std::string Ingredient::getName() const {
-    return name;
+const std::string& Ingredient::getName() const {
+    return IngredientPool::instance().spelling(spelling);
 }
 
-std::string Ingredient::getQuantity() const {
-    return quantity;
+const std::string& Ingredient::getQuantity() const {
+    return IngredientPool::instance().quantity(quantityText);
+}
+
+bool Ingredient::isValidName(const std::string& name) {
+    return name.find_first_of(";:\r\n") == std::string::npos;
+}
+
+bool Ingredient::isValidQuantity(const std::string& quantity) {
+    return quantity.find_first_of(";\r\n") == std::string::npos;
 }
 
 void Ingredient::setName(const std::string& name) {
-    this->name = name;
+    if (!isValidName(name)) {
+        throw std::invalid_argument("Ingredient name cannot contain ';', ':' or line breaks: " + name);
+    }
+    IngredientPool::Name interned = IngredientPool::instance().intern(name);
+    id = interned.id;
+    spelling = interned.spelling;
 }
 
 void Ingredient::setQuantity(const std::string& quantity) {
-    this->quantity = quantity;
+    if (!isValidQuantity(quantity)) {
+        throw std::invalid_argument("Ingredient quantity cannot contain ';' or line breaks: " + quantity);
+    }
+    quantityText = IngredientPool::instance().internQuantity(quantity);
+    parsed = Quantity::parse(quantity);
 }
 
 std::string Ingredient::toString() const {
     std::ostringstream oss;
-    oss << quantity << " " << name;
+    oss << getQuantity() << " " << getName();
     return oss.str();
 }
@@ -1,29 +1,45 @@
 // src/Ingredient.h
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include "IngredientPool.h"
+#include "Quantity.h"
 
+// 24 bytes: three pool ids and the parsed quantity, so a recipe's
+// ingredient list stays a few cache lines (see IngredientList in Recipe.h)
 class Ingredient {
 private:
-    std::string name;
-    std::string quantity; // Using string for flexibility (e.g., "2 cups", "1 pinch")
+    IngredientId id;          // Interned, case-folded name (see IngredientPool.h)
+    std::uint32_t spelling;   // Name exactly as entered, for display and saving
+    std::uint32_t quantityText; // Interned original text (e.g., "2 cups", "1 pinch"), kept for saving
+    Quantity parsed;          // Numeric amount and unit, parsed once when the text is set
 
 public:
+    // Throws invalid_argument for text isValidName / isValidQuantity reject
     Ingredient(const std::string& name = "", const std::string& quantity = "");
 
     // Getters
-    std::string getName() const;
-    std::string getQuantity() const;
+    const std::string& getName() const;
+    IngredientId getId() const { return id; }
+    const std::string& getQuantity() const;
+    const Quantity& getParsedQuantity() const { return parsed; }
 
-    // Setters
+    // Setters (same checks as the constructor)
     void setName(const std::string& name);
     void setQuantity(const std::string& quantity);
 
+    // Catalog lines hold "name:quantity" pairs separated by ';' (see
+    // Recipe::serialize): names cannot contain ';' or ':', quantities
+    // cannot contain ';', and neither may contain line breaks
+    static bool isValidName(const std::string& name);
+    static bool isValidQuantity(const std::string& quantity);
+
     // Utility
     std::string toString() const;
 
-    // Operators
+    // Operators (names compare case-insensitively through their ids)
     bool operator==(const Ingredient& other) const {
-        return name == other.name && quantity == other.quantity;
+        return id == other.id && quantityText == other.quantityText;
     }
 };
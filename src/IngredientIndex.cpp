@@ -0,0 +1,141 @@
+// src/IngredientIndex.cpp
+// Implementation of the inverted ingredient index.
+#include "IngredientIndex.h"
+#include "Recipe.h"
+#include <algorithm> // For std::sort
+
+// --- Term Dictionary ---
+PostingList& IngredientIndex::postingsFor(IngredientId id) {
+    if (id >= postings.size()) {
+        postings.resize(id + 1);
+    }
+    return postings[id];
+}
+
+const PostingList* IngredientIndex::find(IngredientId id) const {
+    return id < postings.size() ? &postings[id] : nullptr;
+}
+
+const PostingList* IngredientIndex::find(const std::string& name) const {
+    return find(IngredientPool::instance().find(name));
+}
+
+int IngredientIndex::termCount() const {
+    int count = 0;
+    for (std::size_t i = 0; i < postings.size(); ++i) {
+        if (!postings[i].empty()) count++;
+    }
+    return count;
+}
+
+// --- Lookups ---
+PostingList IngredientIndex::lookup(const std::string& name) const {
+    const PostingList* list = find(name);
+    return list ? *list : PostingList();
+}
+
+PostingList IngredientIndex::lookup(IngredientId id) const {
+    const PostingList* list = find(id);
+    return list ? *list : PostingList();
+}
+
+int IngredientIndex::documentFrequency(const std::string& name) const {
+    const PostingList* list = find(name);
+    return list ? static_cast<int>(list->size()) : 0;
+}
+
+// Orders posting lists by length so the running intersection starts small
+// and only ever shrinks.
+static bool shorterPostingList(const PostingList* a, const PostingList* b) {
+    return a->size() < b->size();
+}
+
+PostingList IngredientIndex::findAll(const std::vector<std::string>& include, const std::vector<std::string>& exclude) const {
+    PostingList result;
+    if (include.empty()) {
+        result = allRecipes;
+    } else {
+        std::vector<const PostingList*> lists;
+        for (std::size_t i = 0; i < include.size(); ++i) {
+            const PostingList* list = find(include[i]);
+            if (!list || list->empty()) {
+                return PostingList(); // An unknown ingredient matches nothing
+            }
+            lists.push_back(list);
+        }
+        std::sort(lists.begin(), lists.end(), shorterPostingList);
+        result = *lists[0];
+        for (std::size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+            result = intersectPostings(result, *lists[i]);
+        }
+    }
+
+    for (std::size_t i = 0; i < exclude.size() && !result.empty(); ++i) {
+        const PostingList* list = find(exclude[i]);
+        if (list) {
+            result = subtractPostings(result, *list);
+        }
+    }
+    return result;
+}
+
+// Trims spaces and tabs from both ends.
+static std::string trimTerm(const std::string& term) {
+    std::size_t first = term.find_first_not_of(" \t");
+    if (first == std::string::npos) return "";
+    std::size_t last = term.find_last_not_of(" \t");
+    return term.substr(first, last - first + 1);
+}
+
+PostingList IngredientIndex::query(const std::string& expression) const {
+    std::vector<std::string> include;
+    std::vector<std::string> exclude;
+
+    std::size_t start = 0;
+    while (start <= expression.size()) {
+        std::size_t separator = expression.find(" AND ", start);
+        std::size_t end = (separator == std::string::npos) ? expression.size() : separator;
+        std::string term = trimTerm(expression.substr(start, end - start));
+
+        if (term.compare(0, 4, "NOT ") == 0) {
+            term = trimTerm(term.substr(4));
+            if (!term.empty()) exclude.push_back(term);
+        } else if (!term.empty()) {
+            include.push_back(term);
+        }
+
+        if (separator == std::string::npos) break;
+        start = separator + 5;
+    }
+
+    if (include.empty() && exclude.empty()) {
+        return PostingList();
+    }
+    return findAll(include, exclude);
+}
+
+// --- RecipeListener Hooks ---
+void IngredientIndex::onRecipeAdded(const Recipe& recipe) {
+    insertPosting(allRecipes, recipe.getId());
+    const IngredientList& ingredients = recipe.getIngredients();
+    for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+        insertPosting(postingsFor(it->getId()), recipe.getId());
+    }
+}
+
+void IngredientIndex::onRecipeRemoved(const Recipe& recipe) {
+    erasePosting(allRecipes, recipe.getId());
+    const IngredientList& ingredients = recipe.getIngredients();
+    for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+        erasePosting(postingsFor(it->getId()), recipe.getId());
+    }
+}
+
+void IngredientIndex::onIngredientAdded(const Recipe& recipe, const Ingredient& ingredient) {
+    insertPosting(postingsFor(ingredient.getId()), recipe.getId());
+}
+
+// A recipe holds each ingredient name at most once, so the posting can go.
+void IngredientIndex::onIngredientRemoved(const Recipe& recipe, const Ingredient& ingredient) {
+    erasePosting(postingsFor(ingredient.getId()), recipe.getId());
+}
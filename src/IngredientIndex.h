@@ -0,0 +1,51 @@
+// src/IngredientIndex.h
+#pragma once
+
+#include <string>
+#include <vector>
+#include "RecipeListener.h"
+#include "PostingList.h"
+#include "IngredientPool.h"
+
+// =============================
+// Inverted Ingredient Index
+// - Maps each ingredient (by its IngredientPool id, so matching ignores
+//   case) to a sorted posting list of the recipe ids that use it
+// - Maintained incrementally as a RecipeStore listener
+// - Boolean queries run as posting-list intersection and difference
+// =============================
+
+class IngredientIndex : public RecipeListener {
+private:
+    std::vector<PostingList> postings;            // Indexed by IngredientId
+    PostingList allRecipes;                       // Universe for pure NOT queries
+
+    PostingList& postingsFor(IngredientId id);
+    const PostingList* find(const std::string& name) const;
+
+public:
+    // Posting list of one ingredient without copying; null if never indexed
+    const PostingList* find(IngredientId id) const;
+
+    // Recipes containing the ingredient (case-insensitive)
+    PostingList lookup(const std::string& name) const;
+    PostingList lookup(IngredientId id) const;
+    int documentFrequency(const std::string& name) const;
+
+    // Recipes containing every name in 'include' and none in 'exclude'.
+    // Lists are intersected shortest first.
+    PostingList findAll(const std::vector<std::string>& include, const std::vector<std::string>& exclude) const;
+
+    // Parses and runs a query such as "tomato AND basil AND NOT cheese".
+    // Terms are separated by the keyword AND; a term prefixed with NOT is excluded.
+    PostingList query(const std::string& expression) const;
+
+    int termCount() const; // Ingredients used by at least one recipe
+    int recipeCount() const { return static_cast<int>(allRecipes.size()); }
+
+    // RecipeListener hooks
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onIngredientAdded(const Recipe& recipe, const Ingredient& ingredient) override;
+    void onIngredientRemoved(const Recipe& recipe, const Ingredient& ingredient) override;
+};
@@ -0,0 +1,169 @@
+// src/IngredientPool.cpp
+// Implementation of the process-wide ingredient name pool.
+#include "IngredientPool.h"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+namespace {
+    // Rough per-entry cost of an unordered_map node and its bucket slot
+    const std::size_t MAP_NODE_OVERHEAD = 2 * sizeof(void*) + sizeof(std::size_t);
+}
+
+std::size_t stringFootprint(std::size_t length) {
+    static const std::size_t inlineCapacity = std::string().capacity(); // Small-string buffer
+    return sizeof(std::string) + (length > inlineCapacity ? length + 1 : 0);
+}
+
+// --- StringChunks ---
+IngredientPool::StringChunks::StringChunks() : count(0) {
+    for (std::size_t i = 0; i < MAX_CHUNKS; ++i) {
+        chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+// Index i lives in chunk k = floor(log2(i / 256 + 1)).
+void IngredientPool::StringChunks::locate(std::size_t index, std::size_t& chunk, std::size_t& offset) {
+    std::size_t shifted = index + (std::size_t(1) << FIRST_CHUNK_BITS);
+    unsigned bit = FIRST_CHUNK_BITS;
+    while ((shifted >> (bit + 1)) != 0) {
+        bit++;
+    }
+    chunk = bit - FIRST_CHUNK_BITS;
+    offset = shifted - (std::size_t(1) << bit);
+}
+
+std::uint32_t IngredientPool::StringChunks::push(const std::string& value) {
+    std::size_t index = count.load(std::memory_order_relaxed);
+    std::size_t chunk, offset;
+    locate(index, chunk, offset);
+    if (chunk >= MAX_CHUNKS || index >= INVALID_INGREDIENT_ID) {
+        throw std::length_error("Ingredient name pool is full");
+    }
+    std::string* slots = chunks[chunk].load(std::memory_order_relaxed);
+    if (!slots) {
+        slots = new std::string[std::size_t(1) << (FIRST_CHUNK_BITS + chunk)];
+        chunks[chunk].store(slots, std::memory_order_release);
+    }
+    slots[offset] = value;
+    count.store(index + 1, std::memory_order_release);
+    return static_cast<std::uint32_t>(index);
+}
+
+const std::string& IngredientPool::StringChunks::at(std::uint32_t index) const {
+    std::size_t chunk, offset;
+    locate(index, chunk, offset);
+    return chunks[chunk].load(std::memory_order_acquire)[offset];
+}
+
+std::size_t IngredientPool::StringChunks::heapBytes() const {
+    std::size_t bytes = 0;
+    for (std::size_t chunk = 0; chunk < MAX_CHUNKS; ++chunk) {
+        if (chunks[chunk].load(std::memory_order_acquire)) {
+            bytes += (std::size_t(1) << (FIRST_CHUNK_BITS + chunk)) * sizeof(std::string);
+        }
+    }
+    std::size_t used = size();
+    for (std::size_t i = 0; i < used; ++i) {
+        bytes += stringFootprint(at(static_cast<std::uint32_t>(i)).size()) - sizeof(std::string);
+    }
+    return bytes;
+}
+
+// --- IngredientPool ---
+// Never destroyed, so ingredients in other static objects stay readable at exit.
+IngredientPool& IngredientPool::instance() {
+    static IngredientPool* pool = new IngredientPool();
+    return *pool;
+}
+
+std::string IngredientPool::fold(const std::string& name) {
+    std::string folded = name;
+    std::transform(folded.begin(), folded.end(), folded.begin(), ::tolower);
+    return folded;
+}
+
+IngredientPool::Name IngredientPool::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unordered_map<std::string, Name>::const_iterator known = bySpelling.find(name);
+    if (known != bySpelling.end()) {
+        return known->second; // Common case: exact spelling seen before
+    }
+
+    Name result;
+    std::string key = fold(name);
+    std::unordered_map<std::string, IngredientId>::const_iterator sameId = byFolded.find(key);
+    if (sameId != byFolded.end()) {
+        result.id = sameId->second;
+    } else {
+        result.id = foldedNames.push(key);
+        byFolded[key] = result.id;
+    }
+    result.spelling = spellings.push(name);
+    bySpelling[name] = result;
+    return result;
+}
+
+IngredientId IngredientPool::find(const std::string& name) const {
+    std::string key = fold(name);
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unordered_map<std::string, IngredientId>::const_iterator it = byFolded.find(key);
+    return it == byFolded.end() ? INVALID_INGREDIENT_ID : it->second;
+}
+
+std::vector<IngredientId> IngredientPool::internAll(std::initializer_list<const char*> names) {
+    std::vector<IngredientId> ids;
+    for (std::initializer_list<const char*>::const_iterator it = names.begin(); it != names.end(); ++it) {
+        ids.push_back(intern(*it).id);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+const std::string& IngredientPool::spelling(std::uint32_t spelling) const {
+    return spellings.at(spelling);
+}
+
+const std::string& IngredientPool::folded(IngredientId id) const {
+    return foldedNames.at(id);
+}
+
+std::uint32_t IngredientPool::internQuantity(const std::string& text) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unordered_map<std::string, std::uint32_t>::const_iterator known = byQuantity.find(text);
+    if (known != byQuantity.end()) {
+        return known->second;
+    }
+    std::uint32_t id = quantities.push(text);
+    byQuantity[text] = id;
+    return id;
+}
+
+const std::string& IngredientPool::quantity(std::uint32_t text) const {
+    return quantities.at(text);
+}
+
+std::size_t IngredientPool::quantityCount() const {
+    return quantities.size();
+}
+
+std::size_t IngredientPool::idCount() const {
+    return foldedNames.size();
+}
+
+std::size_t IngredientPool::spellingCount() const {
+    return spellings.size();
+}
+
+// Chunked strings plus both hash maps (keys are a second copy of each string).
+std::size_t IngredientPool::poolBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t bytes = spellings.heapBytes() + foldedNames.heapBytes();
+    for (std::unordered_map<std::string, Name>::const_iterator it = bySpelling.begin(); it != bySpelling.end(); ++it) {
+        bytes += stringFootprint(it->first.size()) + sizeof(Name) + MAP_NODE_OVERHEAD;
+    }
+    for (std::unordered_map<std::string, IngredientId>::const_iterator it = byFolded.begin(); it != byFolded.end(); ++it) {
+        bytes += stringFootprint(it->first.size()) + sizeof(IngredientId) + MAP_NODE_OVERHEAD;
+    }
+    return bytes;
+}
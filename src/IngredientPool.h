@@ -0,0 +1,108 @@
+// src/IngredientPool.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Case-folded ingredient name ("Onion" and "onion" share one id)
+typedef std::uint32_t IngredientId;
+const IngredientId INVALID_INGREDIENT_ID = 0xFFFFFFFFu;
+
+// =============================
+// Process-wide Ingredient Name Pool
+// - Interns each distinct spelling once and maps it to a compact id
+// - Spellings that are equal up to case share an IngredientId, so name
+//   comparisons become integer compares
+// - Interning is thread-safe (parallel loading); reading a spelling by id
+//   takes no lock
+// - Quantity texts ("200g", "to taste") are interned too, exactly as
+//   written, so an Ingredient holds ids instead of a std::string
+// - The pool lives for the whole process and is never shrunk
+// =============================
+
+class IngredientPool {
+public:
+    // Ids of one interned spelling
+    struct Name {
+        IngredientId id;        // Case-folded name
+        std::uint32_t spelling; // Exact text
+    };
+
+    static IngredientPool& instance();
+
+    Name intern(const std::string& name);
+
+    // Case-folded lookup that never adds; INVALID_INGREDIENT_ID if unseen.
+    IngredientId find(const std::string& name) const;
+
+    // Interns every name and returns the ids sorted (for binary_search).
+    std::vector<IngredientId> internAll(std::initializer_list<const char*> names);
+
+    const std::string& spelling(std::uint32_t spelling) const;
+    const std::string& folded(IngredientId id) const;
+
+    // Quantity text ids (not case-folded)
+    std::uint32_t internQuantity(const std::string& text);
+    const std::string& quantity(std::uint32_t text) const;
+
+    std::size_t idCount() const;
+    std::size_t spellingCount() const;
+    std::size_t quantityCount() const;
+    std::size_t poolBytes() const; // Approximate heap held by the name tables
+
+    static std::string fold(const std::string& name); // Lowercase copy
+
+private:
+    // Append-only string storage whose chunks never move, so readers can
+    // index it without the lock while new strings are being added.
+    // Chunk k holds 256 << k strings, so 24 chunks cover every 32-bit id.
+    class StringChunks {
+    public:
+        static const unsigned FIRST_CHUNK_BITS = 8;
+        static const std::size_t MAX_CHUNKS = 24;
+
+        StringChunks();
+        std::uint32_t push(const std::string& value); // Caller holds the pool mutex
+        const std::string& at(std::uint32_t index) const;
+        std::size_t size() const { return count.load(std::memory_order_acquire); }
+        std::size_t heapBytes() const;
+    private:
+        std::atomic<std::string*> chunks[MAX_CHUNKS];
+        std::atomic<std::size_t> count;
+
+        static void locate(std::size_t index, std::size_t& chunk, std::size_t& offset);
+    };
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Name> bySpelling;  // Exact text -> ids
+    std::unordered_map<std::string, IngredientId> byFolded;
+    std::unordered_map<std::string, std::uint32_t> byQuantity;
+    StringChunks spellings;
+    StringChunks foldedNames;
+    StringChunks quantities;
+
+    IngredientPool() {}
+
+    // Not copyable: there is exactly one pool
+    IngredientPool(const IngredientPool&);
+    IngredientPool& operator=(const IngredientPool&);
+};
+
+// Ingredient name memory with interning versus one std::string per name
+struct InternStats {
+    std::size_t references;    // Ingredient names counted
+    std::size_t internedBytes; // Ids inside the ingredients + the pool itself
+    std::size_t stringBytes;   // Same names stored as separate std::strings
+
+    InternStats() : references(0), internedBytes(0), stringBytes(0) {}
+    long long savedBytes() const { return static_cast<long long>(stringBytes) - static_cast<long long>(internedBytes); }
+};
+
+// Bytes a std::string of 'length' characters occupies (object + heap).
+std::size_t stringFootprint(std::size_t length);
@@ -4,6 +4,17 @@
 #include <cstddef> // for size_t
 #include <stdexcept> // for std::out_of_range
 #include <iterator> // for iterator tags
+#include <type_traits> // for std::aligned_storage
+#include <vector> // for topK results and the skip index
+
+// How a LinkedList obtains storage for its nodes.
+// - Pooled:  nodes are carved out of contiguous chunks owned by the list and
+//            recycled through a free list; clear() releases whole chunks.
+// - PerNode: one new/delete per element (the original behaviour).
+enum class NodeAllocation {
+    Pooled,
+    PerNode
+};
 
 // =============================
 // Custom Doubly-Linked List (Template)
@@ -12,6 +23,7 @@
 // - Head/tail pointers for O(1) push_back
 // - Custom iterator for safe traversal
 // - Safe memory management
+// - Pooled node storage (chunked slab + free list) by default
 // =============================
 
 // Doubly-linked list template
@@ -28,62 +40,118 @@ private:
         Node(const T& value, Node* next = nullptr, Node* prev = nullptr) : value(value), next(next), prev(prev) {} 
     };
 
+    // Raw storage for one node; doubles as a free-list link while unused.
+    typedef typename std::aligned_storage<sizeof(Node), alignof(Node)>::type Slot;
+
+    // A block of node slots. Chunks are chained so the pool can be released
+    // in one pass regardless of how many nodes were handed out.
+    struct Chunk {
+        Chunk* next;
+        Slot* slots;
+        std::size_t capacity;
+    };
+
+    static const std::size_t INITIAL_CHUNK_NODES = 8;
+    static const std::size_t MAX_CHUNK_NODES = 4096;
+
     Node* head;
     Node* tail; // Added tail pointer for O(1) push_back and reverse traversal
     int count;
 
+    // Node pool state (unused when allocation == NodeAllocation::PerNode)
+    NodeAllocation allocation;
+    Chunk* chunks;          // Newest chunk first
+    std::size_t chunkUsed;  // Slots handed out from the newest chunk
+    void* freeSlots;        // Singly-linked list of recycled slots
+
+    // Positional skip index (see iteratorAt)
+    static const int POSITION_STRIDE = 64;
+    mutable std::vector<Node*> positions;
+    mutable bool positionsValid;
+    const Node* nodeAt(int index) const;
+    void invalidatePositions() { positionsValid = false; }
+
+    // Node allocation helpers
+    template <typename U>
+    Node* createNode(U&& value);
+    void destroyNode(Node* node);
+    void unlinkNode(Node* node);
+    void adoptChunks(LinkedList& other);
+    void linkBefore(Node* before, Node* first, Node* last, int nodes);
+    void* acquireSlot();
+    void releaseChunks();
+    void stealFrom(LinkedList& other);
+
 public:
     // --- Iterator --- 
+    // Bidirectional: -- on end() steps back to the tail
     class iterator {
     public:
-        using iterator_category = std::forward_iterator_tag;
+        using iterator_category = std::bidirectional_iterator_tag;
         using difference_type   = std::ptrdiff_t;
         using value_type        = T;
         using pointer           = T*;  
         using reference         = T&; 
 
-        iterator(Node* ptr) : m_ptr(ptr) {} 
+        iterator(Node* ptr = nullptr, const LinkedList* list = nullptr) : m_ptr(ptr), m_list(list) {} 
 
         reference operator*() const { return m_ptr->value; }
-        pointer operator->() { return &(m_ptr->value); }
+        pointer operator->() const { return &(m_ptr->value); }
         iterator& operator++() { m_ptr = m_ptr->next; return *this; }
         iterator operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+        iterator& operator--() { m_ptr = m_ptr ? m_ptr->prev : m_list->tail; return *this; }
+        iterator operator--(int) { iterator tmp = *this; --(*this); return tmp; }
 
         friend bool operator== (const iterator& a, const iterator& b) { return a.m_ptr == b.m_ptr; };
         friend bool operator!= (const iterator& a, const iterator& b) { return a.m_ptr != b.m_ptr; }; 
 
     private:
+        friend class LinkedList;
         Node* m_ptr;
+        const LinkedList* m_list; // For stepping back from end()
     };
     // --- End Iterator ---
 
     // --- Const Iterator --- (Needed for iterating over const LinkedList)
     class const_iterator {
     public:
-        using iterator_category = std::forward_iterator_tag;
+        using iterator_category = std::bidirectional_iterator_tag;
         using difference_type   = std::ptrdiff_t;
         using value_type        = const T; // Value is const
         using pointer           = const T*;  
         using reference         = const T&; 
 
-        const_iterator(const Node* ptr) : m_ptr(ptr) {} // Takes const Node*
+        const_iterator(const Node* ptr = nullptr, const LinkedList* list = nullptr) : m_ptr(ptr), m_list(list) {} // Takes const Node*
+        const_iterator(const iterator& it) : m_ptr(it.m_ptr), m_list(it.m_list) {}
 
         reference operator*() const { return m_ptr->value; }
         pointer operator->() const { return &(m_ptr->value); } // Return const T*
         const_iterator& operator++() { m_ptr = m_ptr->next; return *this; }
         const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+        const_iterator& operator--() { m_ptr = m_ptr ? m_ptr->prev : m_list->tail; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; --(*this); return tmp; }
 
         friend bool operator== (const const_iterator& a, const const_iterator& b) { return a.m_ptr == b.m_ptr; };
         friend bool operator!= (const const_iterator& a, const const_iterator& b) { return a.m_ptr != b.m_ptr; }; 
 
     private:
         const Node* m_ptr; // Pointer to const Node
+        const LinkedList* m_list;
     };
     // --- End Const Iterator ---
 
-    LinkedList();
+    explicit LinkedList(NodeAllocation allocation = NodeAllocation::Pooled);
     ~LinkedList();
 
+    // Copies are deep and keep the source's NodeAllocation. Lists of owning
+    // pointers (clear() deletes them) cannot be copied, only moved.
+    // Moves steal the nodes, chunks and skip index in O(1), leaving the
+    // source empty and usable.
+    LinkedList(const LinkedList& other);
+    LinkedList(LinkedList&& other);
+    LinkedList& operator=(const LinkedList& other);
+    LinkedList& operator=(LinkedList&& other);
+
     // Basic operations
     void push_back(const T& value); // Overload for const T&
     void push_back(T&& value); // Existing rvalue overload
@@ -91,6 +159,23 @@ public:
     template <typename Predicate>
     bool removeIf(Predicate pred); // Removes the first element matching the predicate
 
+    // Handle-based removal and relinking (iterators stay valid until their
+    // own element is erased)
+    // - erase: O(1) unlink through the prev link; returns the next element.
+    //          'position' must belong to this list; end() throws out_of_range
+    // - erase_if: removes every match in one pass; returns how many
+    // - splice: moves all of 'other' in front of 'position' (end() appends),
+    //           leaving it empty. O(1) relink when both lists use the same
+    //           NodeAllocation (pooled chunks are adopted); otherwise each
+    //           value is moved into a new node
+    // - merge: stable merge of sorted 'other' into this sorted list
+    iterator erase(iterator position);
+    template <typename Predicate>
+    int erase_if(Predicate pred);
+    void splice(iterator position, LinkedList& other);
+    template <typename Compare>
+    void merge(LinkedList& other, Compare comp);
+
     int size() const;
     bool isEmpty() const;
 
@@ -109,20 +194,60 @@ public:
     const_iterator cbegin() const;
     const_iterator cend() const; 
 
+    // Reverse iteration (tail to head)
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    // Element at a 0-based position; throws std::out_of_range. Jumps through
+    // a skip index holding every POSITION_STRIDE-th node, then walks at most
+    // POSITION_STRIDE - 1 nodes. The index is built by the first lookup,
+    // extended by push_back and rebuilt after any other structural change.
+    iterator iteratorAt(int index);
+    const_iterator iteratorAt(int index) const;
+
     // Doubly-linked list accessors
     Node* getHead() const { return head; }
     Node* getTail() const { return tail; }
     int getSize() const { return count; }
+    NodeAllocation getAllocation() const { return allocation; }
 
     // Algorithms (declaration)
+    // All sorts are stable and leave prev pointers and tail consistent.
+    // - insertionSort: O(n + inversions), best for small or nearly-sorted lists
+    // - mergeSort: bottom-up O(n log n) merge on the node chain, no extra allocation
+    // - sort: adaptive; insertion sort for short lists, otherwise a bounded
+    //         insertion pass that falls back to mergeSort once it does too much work
     template <typename Compare> 
     void insertionSort(Compare comp);
+
+    template <typename Compare>
+    void mergeSort(Compare comp);
     
     iterator linearSearch(const T& target);
     const_iterator linearSearch(const T& target) const;
 
     template <typename Compare>
-    void sort(Compare comp) { insertionSort(comp); }
+    void sort(Compare comp);
+
+    // The first k elements in 'comp' order (ties keep list order), without
+    // reordering the list: a bounded heap of k entries, O(n log k)
+    template <typename Compare>
+    std::vector<T> topK(std::size_t k, Compare comp) const;
+
+private:
+    static const int INSERTION_SORT_THRESHOLD = 16;
+
+    // Sorting helpers
+    template <typename Compare>
+    bool insertionSortBounded(Compare comp, std::size_t maxShifts);
+    static Node* splitAfter(Node* run, std::size_t length);
+    template <typename Compare>
+    static void mergeRuns(Node* left, Node* right, Compare comp, Node*& mergedHead, Node*& mergedTail);
+    void relinkPrev();
 };
 
 // Include the template implementation file
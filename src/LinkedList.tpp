@@ -1,11 +1,25 @@
 // src/LinkedList.tpp
 // Implementation for LinkedList template class
 
+#include <algorithm> // For std::push_heap, std::pop_heap, std::sort_heap
 #include <utility> // For std::swap
 #include <type_traits>
+#include <new> // For placement new
 
 // Helper for deleting pointer types in C++11
 namespace detail {
+    // Orders (value, list position) entries by 'comp', ties by position
+    template<typename T, typename Compare>
+    struct TopKOrder {
+        Compare comp;
+        explicit TopKOrder(Compare comp) : comp(comp) {}
+        bool operator()(const std::pair<const T*, std::size_t>& a, const std::pair<const T*, std::size_t>& b) const {
+            if (comp(*a.first, *b.first)) return true;
+            if (comp(*b.first, *a.first)) return false;
+            return a.second < b.second;
+        }
+    };
+
     template<typename T, bool is_ptr>
     struct PointerDeleter {
         static void deleteValue(T&) {}
@@ -18,31 +32,163 @@ namespace detail {
 
 // --- Constructor/Destructor ---
 template <typename T>
-LinkedList<T>::LinkedList() : head(nullptr), tail(nullptr), count(0) {}
+LinkedList<T>::LinkedList(NodeAllocation allocation)
+    : head(nullptr), tail(nullptr), count(0),
+      allocation(allocation), chunks(nullptr), chunkUsed(0), freeSlots(nullptr),
+      positionsValid(false) {}
 
 template <typename T>
 LinkedList<T>::~LinkedList() {
     clear();
 }
 
+// --- Copy/Move ---
+template <typename T>
+LinkedList<T>::LinkedList(const LinkedList& other) : LinkedList(other.allocation) {
+    static_assert(!std::is_pointer<T>::value, "LinkedList of owning pointers cannot be copied; move it instead");
+    for (const Node* node = other.head; node != nullptr; node = node->next) {
+        push_back(node->value);
+    }
+}
+
+template <typename T>
+LinkedList<T>::LinkedList(LinkedList&& other) : LinkedList(other.allocation) {
+    stealFrom(other);
+}
+
+// Copy-and-move: the list is unchanged if copying a value throws
+template <typename T>
+LinkedList<T>& LinkedList<T>::operator=(const LinkedList& other) {
+    if (this != &other) {
+        LinkedList copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename T>
+LinkedList<T>& LinkedList<T>::operator=(LinkedList&& other) {
+    if (this != &other) {
+        clear();
+        allocation = other.allocation;
+        stealFrom(other);
+    }
+    return *this;
+}
+
+// Takes over the node chain and pool of 'other'. Expects this list to be empty.
+template <typename T>
+void LinkedList<T>::stealFrom(LinkedList& other) {
+    head = other.head;
+    tail = other.tail;
+    count = other.count;
+    chunks = other.chunks;
+    chunkUsed = other.chunkUsed;
+    freeSlots = other.freeSlots;
+    positions.swap(other.positions);
+    positionsValid = other.positionsValid;
+
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.count = 0;
+    other.chunks = nullptr;
+    other.chunkUsed = 0;
+    other.freeSlots = nullptr;
+    other.positions.clear();
+    other.positionsValid = false;
+}
+
 template <typename T>
 void LinkedList<T>::clear() {
     Node* current = head;
     while (current != nullptr) {
         Node* next = current->next;
         detail::PointerDeleter<T, std::is_pointer<T>::value>::deleteValue(current->value);
-        delete current;
+        if (allocation == NodeAllocation::Pooled) {
+            current->~Node(); // Storage goes back with its chunk below
+        } else {
+            delete current;
+        }
         current = next;
     }
+    releaseChunks();
     head = nullptr;
     tail = nullptr;
     count = 0;
+    invalidatePositions();
+}
+
+// --- Node Pool ---
+// Hands out a slot for one node: recycled slots first, then the newest
+// chunk, then a fresh chunk twice the size of the previous one.
+template <typename T>
+void* LinkedList<T>::acquireSlot() {
+    if (freeSlots != nullptr) {
+        void* slot = freeSlots;
+        freeSlots = *static_cast<void**>(slot);
+        return slot;
+    }
+    if (chunks == nullptr || chunkUsed == chunks->capacity) {
+        std::size_t capacity = INITIAL_CHUNK_NODES;
+        if (chunks != nullptr) {
+            capacity = chunks->capacity * 2;
+            if (capacity > MAX_CHUNK_NODES) capacity = MAX_CHUNK_NODES;
+        }
+        Chunk* chunk = new Chunk;
+        chunk->slots = static_cast<Slot*>(::operator new(capacity * sizeof(Slot)));
+        chunk->capacity = capacity;
+        chunk->next = chunks;
+        chunks = chunk;
+        chunkUsed = 0;
+    }
+    return &chunks->slots[chunkUsed++];
+}
+
+// Frees every chunk at once. Nodes must already have been destroyed.
+template <typename T>
+void LinkedList<T>::releaseChunks() {
+    while (chunks != nullptr) {
+        Chunk* next = chunks->next;
+        ::operator delete(chunks->slots);
+        delete chunks;
+        chunks = next;
+    }
+    chunkUsed = 0;
+    freeSlots = nullptr;
+}
+
+template <typename T>
+template <typename U>
+typename LinkedList<T>::Node* LinkedList<T>::createNode(U&& value) {
+    if (allocation == NodeAllocation::PerNode) {
+        return new Node(std::forward<U>(value), nullptr, tail);
+    }
+    void* slot = acquireSlot();
+    try {
+        return new (slot) Node(std::forward<U>(value), nullptr, tail);
+    } catch (...) {
+        *static_cast<void**>(slot) = freeSlots; // Give the slot back
+        freeSlots = slot;
+        throw;
+    }
+}
+
+template <typename T>
+void LinkedList<T>::destroyNode(Node* node) {
+    if (allocation == NodeAllocation::PerNode) {
+        delete node;
+        return;
+    }
+    node->~Node();
+    void* slot = node;
+    *static_cast<void**>(slot) = freeSlots;
+    freeSlots = slot;
 }
 
 // --- Basic Operations ---
 template <typename T>
 void LinkedList<T>::push_back(const T& value) {
-    Node* newNode = new Node(value, nullptr, tail);
+    Node* newNode = createNode(value);
     if (head == nullptr) {
         head = tail = newNode;
     } else {
@@ -50,12 +196,15 @@ void LinkedList<T>::push_back(const T& value) {
         newNode->prev = tail;
         tail = newNode;
     }
+    if (positionsValid && count % POSITION_STRIDE == 0) {
+        positions.push_back(newNode); // Appending never shifts earlier positions
+    }
     count++;
 }
 
 template <typename T>
 void LinkedList<T>::push_back(T&& value) {
-    Node* newNode = new Node(std::move(value), nullptr, tail);
+    Node* newNode = createNode(std::move(value));
     if (head == nullptr) {
         head = tail = newNode;
     } else {
@@ -63,33 +212,19 @@ void LinkedList<T>::push_back(T&& value) {
         newNode->prev = tail;
         tail = newNode;
     }
+    if (positionsValid && count % POSITION_STRIDE == 0) {
+        positions.push_back(newNode); // Appending never shifts earlier positions
+    }
     count++;
 }
 
 template <typename T>
 bool LinkedList<T>::remove(const T& value) {
-    if (head == nullptr) {
-        return false;
-    }
-
-    if (head->value == value) { // Check if head needs removal
-        Node* temp = head;
-        head = head->next;
-        delete temp;
-        count--;
-        return true;
-    }
-
-    Node* current = head;
-    while (current->next != nullptr) {
-        if (current->next->value == value) {
-            Node* temp = current->next;
-            current->next = current->next->next;
-            delete temp;
-            count--;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        if (current->value == value) {
+            unlinkNode(current);
             return true;
         }
-        current = current->next;
     }
     return false; // Value not found
 }
@@ -97,33 +232,134 @@ bool LinkedList<T>::remove(const T& value) {
 template <typename T>
 template <typename Predicate>
 bool LinkedList<T>::removeIf(Predicate pred) {
-    if (head == nullptr) {
-        return false;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        if (pred(current->value)) {
+            unlinkNode(current);
+            return true;
+        }
     }
+    return false; // No element satisfied the predicate
+}
 
-    // Check if the head node should be removed
-    if (pred(head->value)) {
-        Node* temp = head;
-        head = head->next;
-        delete temp;
-        count--;
-        return true;
+// Detaches a node, keeping head, tail and both link directions intact, and frees it.
+template <typename T>
+void LinkedList<T>::unlinkNode(Node* node) {
+    if (node->prev) node->prev->next = node->next;
+    else head = node->next;
+    if (node->next) node->next->prev = node->prev;
+    else tail = node->prev;
+    destroyNode(node);
+    count--;
+    invalidatePositions();
+}
+
+// --- Handle-Based Removal and Relinking ---
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::erase(iterator position) {
+    Node* node = position.m_ptr;
+    if (node == nullptr) {
+        throw std::out_of_range("LinkedList::erase: cannot erase end()");
     }
+    Node* next = node->next;
+    unlinkNode(node);
+    return iterator(next, this);
+}
 
-    // Iterate through the rest of the list
+template <typename T>
+template <typename Predicate>
+int LinkedList<T>::erase_if(Predicate pred) {
+    int removed = 0;
     Node* current = head;
-    while (current->next != nullptr) {
-        if (pred(current->next->value)) {
-            Node* temp = current->next;
-            current->next = current->next->next;
-            delete temp;
-            count--;
-            return true;
+    while (current != nullptr) {
+        Node* next = current->next;
+        if (pred(current->value)) {
+            unlinkNode(current);
+            removed++;
         }
-        current = current->next;
+        current = next;
     }
+    return removed;
+}
 
-    return false; // No element satisfied the predicate
+// Takes ownership of every pooled chunk of 'other'. Its chunks go behind
+// our newest chunk so chunkUsed still describes that one; its free slots
+// are dropped (the memory is released with the adopted chunks).
+template <typename T>
+void LinkedList<T>::adoptChunks(LinkedList& other) {
+    if (other.chunks != nullptr) {
+        if (chunks == nullptr) {
+            chunks = other.chunks;
+            chunkUsed = other.chunkUsed;
+            freeSlots = other.freeSlots;
+        } else {
+            Chunk* last = other.chunks;
+            while (last->next != nullptr) {
+                last = last->next;
+            }
+            last->next = chunks->next;
+            chunks->next = other.chunks;
+        }
+    }
+    other.chunks = nullptr;
+    other.chunkUsed = 0;
+    other.freeSlots = nullptr;
+}
+
+// Links the chain first..last (nodes long) in front of 'before'
+// (nullptr appends).
+template <typename T>
+void LinkedList<T>::linkBefore(Node* before, Node* first, Node* last, int nodes) {
+    Node* previous = before ? before->prev : tail;
+    first->prev = previous;
+    last->next = before;
+    if (previous) previous->next = first;
+    else head = first;
+    if (before) before->prev = last;
+    else tail = last;
+    count += nodes;
+    invalidatePositions();
+}
+
+template <typename T>
+void LinkedList<T>::splice(iterator position, LinkedList& other) {
+    if (&other == this || other.head == nullptr) {
+        return;
+    }
+    if (allocation != other.allocation) { // Storage can't change hands
+        while (other.head != nullptr) {
+            Node* node = createNode(std::move(other.head->value));
+            linkBefore(position.m_ptr, node, node, 1);
+            other.unlinkNode(other.head);
+        }
+        return;
+    }
+    if (allocation == NodeAllocation::Pooled) {
+        adoptChunks(other);
+    }
+    linkBefore(position.m_ptr, other.head, other.tail, other.count);
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.count = 0;
+}
+
+// Appends 'other' then merges the two sorted runs in place
+template <typename T>
+template <typename Compare>
+void LinkedList<T>::merge(LinkedList& other, Compare comp) {
+    if (&other == this || other.head == nullptr) {
+        return;
+    }
+    Node* left = head;
+    Node* oldTail = tail;
+    splice(end(), other);
+    if (left == nullptr) {
+        return; // This list was empty; 'other' is already sorted
+    }
+    Node* right = oldTail->next;
+    oldTail->next = nullptr;
+    Node* mergedTail;
+    mergeRuns(left, right, comp, head, mergedTail);
+    relinkPrev();
 }
 
 template <typename T>
@@ -139,67 +375,270 @@ bool LinkedList<T>::isEmpty() const {
 // --- Iterator Support ---
 template <typename T>
 typename LinkedList<T>::iterator LinkedList<T>::begin() {
-    return iterator(head);
+    return iterator(head, this);
 }
 
 template <typename T>
 typename LinkedList<T>::iterator LinkedList<T>::end() {
-    return iterator(nullptr); // Points one past the end
+    return iterator(nullptr, this); // Points one past the end
 }
 
 // --- Const Iterator Support Implementation ---
 template <typename T>
 typename LinkedList<T>::const_iterator LinkedList<T>::begin() const {
-    return const_iterator(head);
+    return const_iterator(head, this);
 }
 
 template <typename T>
 typename LinkedList<T>::const_iterator LinkedList<T>::end() const {
-    return const_iterator(nullptr);
+    return const_iterator(nullptr, this);
 }
 
 template <typename T>
 typename LinkedList<T>::const_iterator LinkedList<T>::cbegin() const {
-    return const_iterator(head);
+    return const_iterator(head, this);
 }
 
 template <typename T>
 typename LinkedList<T>::const_iterator LinkedList<T>::cend() const {
-    return const_iterator(nullptr);
+    return const_iterator(nullptr, this);
+}
+
+// --- Positional Access ---
+template <typename T>
+const typename LinkedList<T>::Node* LinkedList<T>::nodeAt(int index) const {
+    if (index < 0 || index >= count) {
+        throw std::out_of_range("LinkedList::iteratorAt: index out of range");
+    }
+    if (!positionsValid) {
+        positions.clear();
+        int position = 0;
+        for (Node* current = head; current != nullptr; current = current->next, ++position) {
+            if (position % POSITION_STRIDE == 0) positions.push_back(current);
+        }
+        positionsValid = true;
+    }
+    const Node* node = positions[index / POSITION_STRIDE];
+    for (int step = index % POSITION_STRIDE; step > 0; --step) {
+        node = node->next;
+    }
+    return node;
+}
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::iteratorAt(int index) {
+    return iterator(const_cast<Node*>(nodeAt(index)), this);
+}
+
+template <typename T>
+typename LinkedList<T>::const_iterator LinkedList<T>::iteratorAt(int index) const {
+    return const_iterator(nodeAt(index), this);
 }
 
 // --- Insertion Sort Implementation --- 
 template <typename T>
 template <typename Compare>
 void LinkedList<T>::insertionSort(Compare comp) {
+    insertionSortBounded(comp, static_cast<std::size_t>(-1));
+}
+
+// Walks forward; each out-of-place node is moved backwards along the prev
+// links of the already-sorted prefix (re-linked on the way, so stale prev
+// pointers are never followed). Equal elements are never moved past each
+// other, which keeps the sort stable.
+// Gives up and returns false once more than maxShifts backward steps have
+// been taken; the next chain is still intact but prev/tail must be rebuilt.
+template <typename T>
+template <typename Compare>
+bool LinkedList<T>::insertionSortBounded(Compare comp, std::size_t maxShifts) {
     if (!head || !head->next) { 
-        return; // List is empty or has only one element
+        return true; // List is empty or has only one element
     }
 
-    Node* sorted = nullptr; // Head of the sorted list portion
-    Node* current = head;   // Node currently being inserted into the sorted portion
+    std::size_t shifts = 0;
+    invalidatePositions();
+    head->prev = nullptr;
+    Node* sortedTail = head;       // Last node of the sorted prefix
+    Node* current = head->next;    // Node currently being inserted into the sorted prefix
 
     while (current != nullptr) {
         Node* next = current->next; // Save next node before modifying current's links
 
-        // Find the correct position to insert 'current' in the 'sorted' list
-        if (sorted == nullptr || comp(current->value, sorted->value)) {
-            // Insert at the beginning of the sorted list
-            current->next = sorted;
-            sorted = current;
+        if (!comp(current->value, sortedTail->value)) {
+            // Already in place: extend the sorted prefix
+            current->prev = sortedTail;
+            sortedTail = current;
         } else {
-            // Find the node *before* the insertion point in the sorted list
-            Node* search = sorted;
-            while (search->next != nullptr && comp(search->next->value, current->value)) {
-                search = search->next;
+            // Find the node *before* the insertion point, scanning backwards
+            Node* search = sortedTail->prev;
+            while (search != nullptr && comp(current->value, search->value)) {
+                search = search->prev;
+                if (++shifts > maxShifts) {
+                    return false;
+                }
+            }
+            // Unlink 'current' from behind the sorted prefix...
+            sortedTail->next = next;
+            // ...and insert it after 'search' (or at the front)
+            Node* after = search ? search->next : head;
+            current->prev = search;
+            current->next = after;
+            after->prev = current;
+            if (search) {
+                search->next = current;
+            } else {
+                head = current;
             }
-            // Insert 'current' after 'search'
-            current->next = search->next;
-            search->next = current;
         }
         current = next; // Move to the next node in the original list
     }
-    head = sorted; // Update the list head to the new sorted list
+    tail = sortedTail;
+    return true;
+}
+
+// --- Merge Sort Implementation ---
+// Bottom-up: merges runs of width 1, 2, 4, ... in place by relinking nodes
+// until a single pass performs at most one merge.
+template <typename T>
+template <typename Compare>
+void LinkedList<T>::mergeSort(Compare comp) {
+    if (!head || !head->next) {
+        return;
+    }
+
+    for (std::size_t width = 1; ; width *= 2) {
+        Node* remaining = head;
+        Node* sortedHead = nullptr;
+        Node* sortedTail = nullptr;
+        std::size_t merges = 0;
+
+        while (remaining != nullptr) {
+            Node* left = remaining;
+            Node* right = splitAfter(left, width);
+            remaining = splitAfter(right, width);
+
+            Node* mergedHead;
+            Node* mergedTail;
+            mergeRuns(left, right, comp, mergedHead, mergedTail);
+            if (sortedTail) {
+                sortedTail->next = mergedHead;
+            } else {
+                sortedHead = mergedHead;
+            }
+            sortedTail = mergedTail;
+            merges++;
+        }
+
+        head = sortedHead;
+        if (merges <= 1) {
+            break;
+        }
+    }
+    relinkPrev();
+}
+
+// Cuts the chain after 'length' nodes and returns the first node of the rest.
+template <typename T>
+typename LinkedList<T>::Node* LinkedList<T>::splitAfter(Node* run, std::size_t length) {
+    for (std::size_t i = 1; run != nullptr && i < length; ++i) {
+        run = run->next;
+    }
+    if (run == nullptr) {
+        return nullptr;
+    }
+    Node* rest = run->next;
+    run->next = nullptr;
+    return rest;
+}
+
+// Merges two sorted, null-terminated runs. Takes from 'left' on ties so the
+// merge is stable. Only next links are written; relinkPrev() fixes the rest.
+template <typename T>
+template <typename Compare>
+void LinkedList<T>::mergeRuns(Node* left, Node* right, Compare comp, Node*& mergedHead, Node*& mergedTail) {
+    Node* last = nullptr;
+    Node** link = &mergedHead;
+    while (left != nullptr && right != nullptr) {
+        if (comp(right->value, left->value)) {
+            *link = right;
+            right = right->next;
+        } else {
+            *link = left;
+            left = left->next;
+        }
+        last = *link;
+        link = &last->next;
+    }
+    *link = left ? left : right;
+    if (last == nullptr) {
+        last = mergedHead; // One run was empty
+    }
+    while (last->next != nullptr) {
+        last = last->next;
+    }
+    mergedTail = last;
+}
+
+// Rebuilds every prev pointer and the tail from the next chain.
+template <typename T>
+void LinkedList<T>::relinkPrev() {
+    invalidatePositions();
+    Node* previous = nullptr;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        current->prev = previous;
+        previous = current;
+    }
+    tail = previous;
+}
+
+// --- Adaptive Sort ---
+// Short lists go straight to insertion sort. Longer lists get an insertion
+// pass capped at ~n backward steps, which finishes nearly-sorted input in
+// linear time; anything more disordered falls through to mergeSort.
+template <typename T>
+template <typename Compare>
+void LinkedList<T>::sort(Compare comp) {
+    if (count <= INSERTION_SORT_THRESHOLD) {
+        insertionSort(comp);
+        return;
+    }
+    if (!insertionSortBounded(comp, static_cast<std::size_t>(count))) {
+        mergeSort(comp);
+    }
+}
+
+// --- Top-k ---
+// Keeps the best k seen so far in a max-heap whose top is the worst of
+// them; each later element only costs a comparison against that top
+// unless it displaces it.
+template <typename T>
+template <typename Compare>
+std::vector<T> LinkedList<T>::topK(std::size_t k, Compare comp) const {
+    typedef std::pair<const T*, std::size_t> Entry;
+    detail::TopKOrder<T, Compare> order(comp);
+    std::vector<Entry> heap;
+    heap.reserve(std::min(k, static_cast<std::size_t>(count)));
+
+    std::size_t position = 0;
+    for (const Node* current = head; current != nullptr && k > 0; current = current->next, ++position) {
+        Entry entry(&current->value, position);
+        if (heap.size() < k) {
+            heap.push_back(entry);
+            std::push_heap(heap.begin(), heap.end(), order);
+        } else if (order(entry, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), order);
+            heap.back() = entry;
+            std::push_heap(heap.begin(), heap.end(), order);
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), order);
+
+    std::vector<T> result;
+    result.reserve(heap.size());
+    for (std::size_t i = 0; i < heap.size(); ++i) {
+        result.push_back(*heap[i].first);
+    }
+    return result;
 }
 
 template <typename T>
@@ -207,7 +646,7 @@ typename LinkedList<T>::iterator LinkedList<T>::linearSearch(const T& target) {
     Node* current = head;
     while (current) {
         if (current->value == target) {
-            return iterator(current);
+            return iterator(current, this);
         }
         current = current->next;
     }
@@ -219,7 +658,7 @@ typename LinkedList<T>::const_iterator LinkedList<T>::linearSearch(const T& targ
     const Node* current = head;
     while (current) {
         if (current->value == target) {
-            return const_iterator(current);
+            return const_iterator(current, this);
         }
         current = current->next;
     }
@@ -0,0 +1,74 @@
+// src/MappedFile.cpp
+// Read-only file mapping.
+#include "MappedFile.h"
+#include <fstream>
+#include <iterator> // For std::istreambuf_iterator
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : bytes(nullptr), length(0) {}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+// An empty file opens successfully with data() pointing at an empty buffer.
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    std::size_t fileSize = static_cast<std::size_t>(info.st_size);
+    if (fileSize > 0) {
+        void* mapped = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping stays valid after the descriptor is closed
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+        bytes = static_cast<const char*>(mapped);
+        length = fileSize;
+        return true;
+    }
+    ::close(fd);
+#else
+    std::ifstream inFile(filename.c_str(), std::ios::binary);
+    if (!inFile) {
+        return false;
+    }
+    fallbackBuffer.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+    if (!fallbackBuffer.empty()) {
+        bytes = &fallbackBuffer[0];
+        length = fallbackBuffer.size();
+        return true;
+    }
+#endif
+    // Empty file: nothing to map
+    fallbackBuffer.assign(1, '\0');
+    bytes = &fallbackBuffer[0];
+    length = 0;
+    return true;
+}
+
+void MappedFile::close() {
+#ifndef _WIN32
+    if (bytes && fallbackBuffer.empty()) {
+        ::munmap(const_cast<char*>(bytes), length);
+    }
+#endif
+    fallbackBuffer.clear();
+    bytes = nullptr;
+    length = 0;
+}
@@ -0,0 +1,31 @@
+// src/MappedFile.h
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Read-only view of a whole file. Uses mmap where available and falls back
+// to reading the file into memory elsewhere.
+class MappedFile {
+private:
+    const char* bytes;
+    std::size_t length;
+    std::vector<char> fallbackBuffer; // Used where mmap is unavailable
+
+    // Not copyable: owns the mapping
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    // Returns false if the file cannot be opened or mapped.
+    bool open(const std::string& filename);
+    void close();
+
+    bool isOpen() const { return bytes != nullptr; }
+    const char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+};
@@ -1,4 +1,6 @@
 // src/MealType.h
+#pragma once
+
 // Defines the MealType enum to categorize recipes by meal.
 
 enum class MealType {
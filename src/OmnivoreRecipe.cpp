@@ -1,9 +1,10 @@
 // src/OmnivoreRecipe.cpp
 #include "OmnivoreRecipe.h"
 #include <iostream>
+#include <utility> // For std::move
 
-OmnivoreRecipe::OmnivoreRecipe(const std::string& title, int prepTime, MealType mealType)
-    : Recipe(title, prepTime, mealType, DietType::Omnivore) {}
+OmnivoreRecipe::OmnivoreRecipe(std::string title, int prepTime, MealType mealType)
+    : Recipe(std::move(title), prepTime, mealType, DietType::Omnivore) {}
 
 void OmnivoreRecipe::display() const {
     std::cout << "=== Omnivore Recipe ===" << std::endl;
@@ -15,7 +16,7 @@ void OmnivoreRecipe::display() const {
     if (ingredients.isEmpty()) {
         std::cout << "  (No ingredients added yet)" << std::endl;
     } else {
-        for (LinkedList<Ingredient>::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+        for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
             std::cout << "  - " << it->toString() << std::endl;
         }
     }
@@ -5,7 +5,7 @@
 
 class OmnivoreRecipe : public Recipe {
 public:
-    OmnivoreRecipe(const std::string& title = "", 
+    OmnivoreRecipe(std::string title = "", 
                    int prepTime = 0, 
                    MealType mealType = MealType::Other);
 
@@ -13,4 +13,10 @@ public:
     std::string getTypeString() const override { return "Omnivore"; }
     bool isValidForDiet(const Ingredient& ingredient) const override;
     virtual ~OmnivoreRecipe() = default;
+
+    // The declared destructor would suppress the implicit moves
+    OmnivoreRecipe(const OmnivoreRecipe&) = default;
+    OmnivoreRecipe(OmnivoreRecipe&&) = default;
+    OmnivoreRecipe& operator=(const OmnivoreRecipe&) = default;
+    OmnivoreRecipe& operator=(OmnivoreRecipe&&) = default;
 };
@@ -0,0 +1,108 @@
+// src/PostingList.cpp
+// Sorted posting-list maintenance and set operations.
+#include "PostingList.h"
+#include <algorithm> // For std::lower_bound
+
+// --- Maintenance ---
+// Ids are usually assigned in increasing order, so the common case is an append.
+void insertPosting(PostingList& list, RecipeId id) {
+    if (list.empty() || list.back() < id) {
+        list.push_back(id);
+        return;
+    }
+    PostingList::iterator it = std::lower_bound(list.begin(), list.end(), id);
+    if (it == list.end() || *it != id) {
+        list.insert(it, id);
+    }
+}
+
+bool erasePosting(PostingList& list, RecipeId id) {
+    PostingList::iterator it = std::lower_bound(list.begin(), list.end(), id);
+    if (it == list.end() || *it != id) {
+        return false;
+    }
+    list.erase(it);
+    return true;
+}
+
+// --- Galloping Search ---
+// Doubles the probe distance until it overshoots the target, then binary
+// searches the last gap. Costs O(log d) where d is the distance skipped.
+std::size_t gallopTo(const PostingList& list, std::size_t from, RecipeId target) {
+    const std::size_t n = list.size();
+    std::size_t bound = 1;
+    while (from + bound < n && list[from + bound] < target) {
+        bound *= 2;
+    }
+    std::size_t lo = from + bound / 2;
+    std::size_t hi = std::min(from + bound + 1, n);
+    if (lo > hi) lo = hi;
+    return std::lower_bound(list.begin() + lo, list.begin() + hi, target) - list.begin();
+}
+
+// --- Set Operations ---
+PostingList intersectPostings(const PostingList& a, const PostingList& b) {
+    const PostingList& small = a.size() <= b.size() ? a : b;
+    const PostingList& large = a.size() <= b.size() ? b : a;
+    PostingList result;
+    if (small.empty()) {
+        return result;
+    }
+
+    if (large.size() / small.size() >= GALLOP_RATIO) {
+        // Skewed lengths: probe the long list for each id of the short one
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < small.size() && pos < large.size(); ++i) {
+            pos = gallopTo(large, pos, small[i]);
+            if (pos < large.size() && large[pos] == small[i]) {
+                result.push_back(small[i]);
+            }
+        }
+        return result;
+    }
+
+    // Similar lengths: linear merge
+    std::size_t i = 0, j = 0;
+    while (i < small.size() && j < large.size()) {
+        if (small[i] < large[j]) {
+            i++;
+        } else if (large[j] < small[i]) {
+            j++;
+        } else {
+            result.push_back(small[i]);
+            i++;
+            j++;
+        }
+    }
+    return result;
+}
+
+PostingList subtractPostings(const PostingList& a, const PostingList& b) {
+    PostingList result;
+    if (b.empty()) {
+        return a;
+    }
+
+    if (b.size() / (a.size() + 1) >= GALLOP_RATIO) {
+        // Long exclusion list: gallop through it for each kept candidate
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            pos = gallopTo(b, pos, a[i]);
+            if (pos == b.size() || b[pos] != a[i]) {
+                result.push_back(a[i]);
+            }
+        }
+        return result;
+    }
+
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        while (j < b.size() && b[j] < a[i]) {
+            j++;
+        }
+        if (j == b.size() || b[j] != a[i]) {
+            result.push_back(a[i]);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,24 @@
+// src/PostingList.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Recipe.h"
+
+// Sorted, duplicate-free list of recipe ids (one per indexed term)
+typedef std::vector<RecipeId> PostingList;
+
+// Length ratio above which set operations switch from a linear merge to
+// galloping (exponential + binary) search in the longer list.
+const std::size_t GALLOP_RATIO = 16;
+
+// Posting list maintenance (keeps the list sorted)
+void insertPosting(PostingList& list, RecipeId id);
+bool erasePosting(PostingList& list, RecipeId id);
+
+// First position >= from whose id is >= target, found by galloping
+std::size_t gallopTo(const PostingList& list, std::size_t from, RecipeId target);
+
+// Set operations over sorted posting lists
+PostingList intersectPostings(const PostingList& a, const PostingList& b);
+PostingList subtractPostings(const PostingList& a, const PostingList& b); // a AND NOT b
@@ -0,0 +1,126 @@
+// src/PrepTimeIndex.cpp
+// Implementation of the prep-time range index.
+#include "PrepTimeIndex.h"
+#include "Bitset.h"
+#include "Recipe.h"
+#include <algorithm> // For std::sort, std::min, std::max
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    // Above this many ids a range result is merged through a bitset
+    // (linear in the largest id) instead of sorted
+    const std::size_t SORT_LIMIT = 4096;
+
+    // Histograms spanning more buckets than this list only the occupied ones
+    const long long MAX_DENSE_BUCKETS = 1000;
+
+    long long floorDiv(long long value, long long divisor) {
+        long long quotient = value / divisor;
+        return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+    }
+
+    // Bucket b covers [b * width, b * width + width - 1], clamped to int
+    PrepTimeBucket makeBucket(long long b, long long width) {
+        const long long low = std::max<long long>(b * width, std::numeric_limits<int>::min());
+        const long long high = std::min<long long>(b * width + width - 1, std::numeric_limits<int>::max());
+        PrepTimeBucket bucket = { static_cast<int>(low), static_cast<int>(high), 0 };
+        return bucket;
+    }
+}
+
+// --- Maintenance ---
+void PrepTimeIndex::insert(int prepTime, RecipeId id) {
+    PostingList& ids = byPrepTime[prepTime];
+    std::size_t before = ids.size();
+    insertPosting(ids, id);
+    total += ids.size() - before;
+}
+
+void PrepTimeIndex::erase(int prepTime, RecipeId id) {
+    std::map<int, PostingList>::iterator it = byPrepTime.find(prepTime);
+    if (it == byPrepTime.end() || !erasePosting(it->second, id)) return;
+    total--;
+    if (it->second.empty()) byPrepTime.erase(it);
+}
+
+// --- Range Queries ---
+PostingList PrepTimeIndex::findRange(int minMinutes, int maxMinutes) const {
+    PostingList ids;
+    if (minMinutes > maxMinutes) return ids;
+    std::map<int, PostingList>::const_iterator first = byPrepTime.lower_bound(minMinutes);
+    std::map<int, PostingList>::const_iterator last = byPrepTime.upper_bound(maxMinutes);
+    std::size_t lists = 0;
+    for (std::map<int, PostingList>::const_iterator it = first; it != last; ++it) {
+        ids.insert(ids.end(), it->second.begin(), it->second.end());
+        lists++;
+    }
+    if (lists <= 1) return ids; // Already sorted
+    if (ids.size() <= SORT_LIMIT) {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+    Bitset merged;
+    for (std::size_t i = 0; i < ids.size(); ++i) merged.set(static_cast<std::size_t>(ids[i]));
+    return merged.toPostingList();
+}
+
+std::size_t PrepTimeIndex::countRange(int minMinutes, int maxMinutes) const {
+    std::size_t count = 0;
+    if (minMinutes > maxMinutes) return count;
+    std::map<int, PostingList>::const_iterator last = byPrepTime.upper_bound(maxMinutes);
+    for (std::map<int, PostingList>::const_iterator it = byPrepTime.lower_bound(minMinutes); it != last; ++it) {
+        count += it->second.size();
+    }
+    return count;
+}
+
+std::vector<RecipeId> PrepTimeIndex::fastest(std::size_t k, int maxMinutes) const {
+    std::vector<RecipeId> ids;
+    std::map<int, PostingList>::const_iterator last = byPrepTime.upper_bound(maxMinutes);
+    for (std::map<int, PostingList>::const_iterator it = byPrepTime.begin(); it != last && ids.size() < k; ++it) {
+        std::size_t take = std::min(k - ids.size(), it->second.size());
+        ids.insert(ids.end(), it->second.begin(), it->second.begin() + take);
+    }
+    return ids;
+}
+
+std::vector<PrepTimeBucket> PrepTimeIndex::histogram(int bucketMinutes) const {
+    if (bucketMinutes <= 0) {
+        throw std::invalid_argument("Histogram bucket width must be positive");
+    }
+    std::vector<PrepTimeBucket> buckets;
+    if (byPrepTime.empty()) return buckets;
+
+    // Bounds in 64-bit: a bucket's end can pass INT_MAX
+    const long long width = bucketMinutes;
+    const long long first = floorDiv(byPrepTime.begin()->first, width);
+    const long long last = floorDiv(byPrepTime.rbegin()->first, width);
+    const bool dense = last - first < MAX_DENSE_BUCKETS;
+    long long current = first - 1;
+    for (std::map<int, PostingList>::const_iterator it = byPrepTime.begin(); it != byPrepTime.end(); ++it) {
+        const long long b = floorDiv(it->first, width);
+        if (b != current) {
+            for (long long gap = dense ? current + 1 : b; gap <= b; ++gap) {
+                buckets.push_back(makeBucket(gap, width));
+            }
+            current = b;
+        }
+        buckets.back().count += it->second.size();
+    }
+    return buckets;
+}
+
+// --- RecipeListener Hooks ---
+void PrepTimeIndex::onRecipeAdded(const Recipe& recipe) {
+    insert(recipe.getPrepTime(), recipe.getId());
+}
+
+void PrepTimeIndex::onRecipeRemoved(const Recipe& recipe) {
+    erase(recipe.getPrepTime(), recipe.getId());
+}
+
+void PrepTimeIndex::onPrepTimeChanged(const Recipe& recipe, int oldPrepTime) {
+    erase(oldPrepTime, recipe.getId());
+    insert(recipe.getPrepTime(), recipe.getId());
+}
@@ -0,0 +1,58 @@
+// src/PrepTimeIndex.h
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <vector>
+#include "RecipeListener.h"
+#include "PostingList.h"
+
+// Recipes whose prep time falls in [minMinutes, maxMinutes]
+struct PrepTimeBucket {
+    int minMinutes;
+    int maxMinutes;
+    std::size_t count;
+};
+
+// =============================
+// Prep-Time Range Index
+// - Ordered map from prep time to the posting list of recipes taking that
+//   long; prep times are whole minutes with few distinct values, so the
+//   tree stays small and each update is one posting-list insert or erase
+// - Range scans, range counts and histograms walk only the keys in range;
+//   the fastest-k walk stops as soon as k ids are taken
+// - Maintained incrementally as a RecipeStore listener
+// =============================
+
+class PrepTimeIndex : public RecipeListener {
+private:
+    std::map<int, PostingList> byPrepTime;
+    std::size_t total;
+
+    void insert(int prepTime, RecipeId id);
+    void erase(int prepTime, RecipeId id);
+
+public:
+    PrepTimeIndex() : total(0) {}
+
+    // Ids with minMinutes <= prep time <= maxMinutes, in id order
+    PostingList findRange(int minMinutes, int maxMinutes) const;
+    std::size_t countRange(int minMinutes, int maxMinutes) const;
+
+    // Up to k ids taking at most maxMinutes, quickest first (ties by id)
+    std::vector<RecipeId> fastest(std::size_t k, int maxMinutes) const;
+
+    // Counts per 'bucketMinutes'-wide range, from the quickest recipe's
+    // bucket to the slowest one's. Empty ranges in between are included
+    // unless that would take more than 1000 buckets (e.g. one recipe
+    // taking years); then only occupied ranges are listed.
+    std::vector<PrepTimeBucket> histogram(int bucketMinutes) const;
+
+    int size() const { return static_cast<int>(total); }
+    std::size_t keyCount() const { return byPrepTime.size(); } // Distinct prep times
+
+    // RecipeListener hooks
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onPrepTimeChanged(const Recipe& recipe, int oldPrepTime) override;
+};
@@ -0,0 +1,368 @@
+// src/Quantity.cpp
+// Quantity parsing, unit tables and column-wise totals.
+#include "Quantity.h"
+#include <cctype>
+#include <cmath>
+#include <cstdio> // For std::snprintf
+#include <limits>
+#include <sstream>
+
+namespace {
+    struct UnitInfo {
+        Unit unit;
+        UnitKind kind;
+        double toBase;     // Grams, millilitres or count per unit
+        const char* name;  // Canonical short name
+    };
+
+    // Indexed by Unit
+    const UnitInfo UNITS[] = {
+        { Unit::Unknown,    UnitKind::Unknown, 0.0,        "" },
+        { Unit::Piece,      UnitKind::Count,   1.0,        "" },
+        { Unit::Milligram,  UnitKind::Mass,    0.001,      "mg" },
+        { Unit::Gram,       UnitKind::Mass,    1.0,        "g" },
+        { Unit::Kilogram,   UnitKind::Mass,    1000.0,     "kg" },
+        { Unit::Ounce,      UnitKind::Mass,    28.349523,  "oz" },
+        { Unit::Pound,      UnitKind::Mass,    453.59237,  "lb" },
+        { Unit::Milliliter, UnitKind::Volume,  1.0,        "ml" },
+        { Unit::Liter,      UnitKind::Volume,  1000.0,     "l" },
+        { Unit::Teaspoon,   UnitKind::Volume,  4.928922,   "tsp" },
+        { Unit::Tablespoon, UnitKind::Volume,  14.786765,  "tbsp" },
+        { Unit::Cup,        UnitKind::Volume,  236.58824,  "cup" },
+        { Unit::FluidOunce, UnitKind::Volume,  29.573530,  "floz" },
+        { Unit::Pinch,      UnitKind::Volume,  0.308058,   "pinch" },
+        { Unit::Dash,       UnitKind::Volume,  0.616115,   "dash" },
+        { Unit::Clove,      UnitKind::Count,   1.0,        "clove" },
+        { Unit::Slice,      UnitKind::Count,   1.0,        "slice" },
+        { Unit::Strip,      UnitKind::Count,   1.0,        "strip" },
+        { Unit::Sheet,      UnitKind::Count,   1.0,        "sheet" },
+        { Unit::Ball,       UnitKind::Count,   1.0,        "ball" },
+        { Unit::Head,       UnitKind::Count,   1.0,        "head" },
+        { Unit::Can,        UnitKind::Count,   1.0,        "can" },
+        { Unit::Bunch,      UnitKind::Count,   1.0,        "bunch" },
+        { Unit::Sprig,      UnitKind::Count,   1.0,        "sprig" }
+    };
+
+    struct UnitAlias {
+        const char* text;
+        Unit unit;
+    };
+
+    // Lowercase spellings accepted after the number (plural "s" is stripped first)
+    const UnitAlias ALIASES[] = {
+        { "mg", Unit::Milligram }, { "milligram", Unit::Milligram },
+        { "g", Unit::Gram }, { "gr", Unit::Gram }, { "gram", Unit::Gram }, { "gramme", Unit::Gram },
+        { "kg", Unit::Kilogram }, { "kilo", Unit::Kilogram }, { "kilogram", Unit::Kilogram },
+        { "oz", Unit::Ounce }, { "ounce", Unit::Ounce },
+        { "lb", Unit::Pound }, { "pound", Unit::Pound },
+        { "ml", Unit::Milliliter }, { "milliliter", Unit::Milliliter }, { "millilitre", Unit::Milliliter },
+        { "l", Unit::Liter }, { "liter", Unit::Liter }, { "litre", Unit::Liter },
+        { "tsp", Unit::Teaspoon }, { "teaspoon", Unit::Teaspoon },
+        { "tbsp", Unit::Tablespoon }, { "tbs", Unit::Tablespoon }, { "tablespoon", Unit::Tablespoon },
+        { "cup", Unit::Cup }, { "c", Unit::Cup },
+        { "floz", Unit::FluidOunce }, { "fl oz", Unit::FluidOunce }, { "fluid ounce", Unit::FluidOunce },
+        { "pinch", Unit::Pinch }, { "pinche", Unit::Pinch }, { "dash", Unit::Dash }, { "dashe", Unit::Dash },
+        { "clove", Unit::Clove }, { "slice", Unit::Slice }, { "strip", Unit::Strip },
+        { "sheet", Unit::Sheet }, { "ball", Unit::Ball }, { "head", Unit::Head },
+        { "can", Unit::Can }, { "bunch", Unit::Bunch }, { "bunche", Unit::Bunch }, { "sprig", Unit::Sprig },
+        { "piece", Unit::Piece }, { "pc", Unit::Piece }, { "pcs", Unit::Piece }, { "whole", Unit::Piece }
+    };
+
+    Unit lookupUnit(const std::string& word) {
+        for (std::size_t i = 0; i < sizeof(ALIASES) / sizeof(ALIASES[0]); ++i) {
+            if (word == ALIASES[i].text) return ALIASES[i].unit;
+        }
+        if (word.size() > 1 && word[word.size() - 1] == 's') {
+            std::string singular = word.substr(0, word.size() - 1);
+            for (std::size_t i = 0; i < sizeof(ALIASES) / sizeof(ALIASES[0]); ++i) {
+                if (singular == ALIASES[i].text) return ALIASES[i].unit;
+            }
+        }
+        return Unit::Unknown;
+    }
+
+    // Reads "12", "1.5" or ".5"; returns false if no digits were found.
+    bool readDecimal(const char*& cursor, const char* end, double& value) {
+        const char* start = cursor;
+        value = 0.0;
+        while (cursor < end && std::isdigit(static_cast<unsigned char>(*cursor))) {
+            value = value * 10.0 + (*cursor++ - '0');
+        }
+        if (cursor < end && *cursor == '.') {
+            double scale = 0.1;
+            for (++cursor; cursor < end && std::isdigit(static_cast<unsigned char>(*cursor)); ++cursor) {
+                value += (*cursor - '0') * scale;
+                scale *= 0.1;
+            }
+        }
+        bool found = cursor > start && !(cursor - start == 1 && *start == '.');
+        if (!found) cursor = start;
+        return found;
+    }
+
+    void skipSpaces(const char*& cursor, const char* end) {
+        while (cursor < end && (*cursor == ' ' || *cursor == '\t')) ++cursor;
+    }
+
+    // Reads "2", "1.5", "1/2" or "1 1/2".
+    bool readAmount(const char*& cursor, const char* end, double& amount) {
+        double whole;
+        if (!readDecimal(cursor, end, whole)) return false;
+        amount = whole;
+
+        // "1 1/2": whole part, spaces, then a fraction
+        const char* afterWhole = cursor;
+        skipSpaces(cursor, end);
+        double numerator = whole;
+        bool mixed = false;
+        if (cursor > afterWhole) {
+            if (readDecimal(cursor, end, numerator) && cursor < end && *cursor == '/') {
+                mixed = true;
+            } else {
+                cursor = afterWhole;
+                return true;
+            }
+        }
+
+        if (cursor < end && *cursor == '/') {
+            const char* slash = cursor++;
+            double denominator;
+            if (readDecimal(cursor, end, denominator) && denominator != 0.0) {
+                amount = (mixed ? whole : 0.0) + numerator / denominator;
+                return true;
+            }
+            cursor = mixed ? afterWhole : slash;
+        }
+        return true;
+    }
+}
+
+UnitKind unitKind(Unit unit) {
+    return UNITS[static_cast<std::size_t>(unit)].kind;
+}
+
+std::string unitToString(Unit unit) {
+    return UNITS[static_cast<std::size_t>(unit)].name;
+}
+
+Quantity Quantity::parse(const std::string& text) {
+    return parse(text.data(), text.size());
+}
+
+// Number first (optional: "pinch" means one pinch), then a unit word. A bare
+// number counts pieces; anything unrecognized yields Unit::Unknown.
+Quantity Quantity::parse(const char* text, std::size_t length) {
+    Quantity quantity;
+    if (length > std::numeric_limits<std::uint8_t>::max()) {
+        return quantity; // numberEnd could not record where the number stops
+    }
+    const char* cursor = text;
+    const char* end = text + length;
+    skipSpaces(cursor, end);
+
+    double amount = 1.0;
+    bool hasAmount = readAmount(cursor, end, amount);
+    if (hasAmount) {
+        quantity.amount = static_cast<float>(amount);
+        quantity.numberEnd = static_cast<std::uint8_t>(cursor - text);
+    }
+    skipSpaces(cursor, end);
+
+    std::string word;
+    for (; cursor < end; ++cursor) {
+        word.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(*cursor))));
+    }
+    while (!word.empty() && (word[word.size() - 1] == ' ' || word[word.size() - 1] == '\t' || word[word.size() - 1] == '.')) {
+        word.erase(word.size() - 1);
+    }
+
+    Unit unit = word.empty() ? Unit::Piece : lookupUnit(word);
+    if (unit == Unit::Unknown || (!hasAmount && word.empty())) {
+        return quantity; // Unknown unit: base stays 0
+    }
+
+    double base = amount * UNITS[static_cast<std::size_t>(unit)].toBase * 1000.0;
+    if (base > std::numeric_limits<std::int32_t>::max()) {
+        return quantity; // Too large to total safely
+    }
+    quantity.amount = static_cast<float>(amount);
+    quantity.unit = unit;
+    quantity.base = static_cast<std::int32_t>(std::floor(base + 0.5));
+    return quantity;
+}
+
+// --- Scaling ---
+Quantity Quantity::scaled(double factor) const {
+    Quantity result = *this;
+    result.amount = static_cast<float>(amount * factor);
+    double scaledBase = std::floor(base * factor + 0.5);
+    if (scaledBase > std::numeric_limits<std::int32_t>::max() || scaledBase < 0.0) {
+        result.unit = Unit::Unknown;
+        result.base = 0;
+    } else {
+        result.base = static_cast<std::int32_t>(scaledBase);
+    }
+    return result;
+}
+
+// Up to two decimals, without trailing zeros ("3", "0.75", "1.5").
+static void appendAmount(std::string& out, double amount) {
+    char buffer[32];
+    double rounded = std::floor(amount * 100.0 + 0.5) / 100.0;
+    int written = std::snprintf(buffer, sizeof(buffer), "%.2f", rounded);
+    if (written <= 0 || written >= static_cast<int>(sizeof(buffer))) return;
+    while (written > 1 && buffer[written - 1] == '0') --written;
+    if (buffer[written - 1] == '.') --written;
+    out.append(buffer, static_cast<std::size_t>(written));
+}
+
+void Quantity::appendScaledText(std::string& out, const std::string& text, double factor) const {
+    if (factor == 1.0 || (numberEnd == 0 && !isKnown())) {
+        out += text;
+    } else if (numberEnd == 0) { // Unit without a number: "pinch" is one pinch
+        appendAmount(out, amount * factor);
+        out += ' ';
+        out += text;
+    } else {
+        appendAmount(out, static_cast<double>(amount) * factor);
+        out.append(text, numberEnd, std::string::npos);
+    }
+}
+
+// --- Totals ---
+void QuantityTotals::add(const Quantity& quantity, const std::string& text) {
+    switch (quantity.kind()) {
+        case UnitKind::Mass:
+            milligrams += quantity.base;
+            break;
+        case UnitKind::Volume:
+            microliters += quantity.base;
+            break;
+        case UnitKind::Count:
+            if (countUnit == Unit::Unknown) countUnit = quantity.unit;
+            if (quantity.unit != countUnit) {
+                addOtherCount(quantity.unit, quantity.base); // 2 cloves and 1 head do not add up
+            } else {
+                milliCount += quantity.base;
+            }
+            break;
+        default:
+            skipped++;
+            addUnmeasured(text);
+            return;
+    }
+    summed++;
+}
+
+// Linear searches: an ingredient rarely comes in more than a few units or texts
+void QuantityTotals::addOtherCount(Unit unit, std::int64_t milliCount) {
+    for (std::size_t i = 0; i < otherCounts.size(); ++i) {
+        if (otherCounts[i].first == unit) {
+            otherCounts[i].second += milliCount;
+            return;
+        }
+    }
+    otherCounts.push_back(std::make_pair(unit, milliCount));
+}
+
+void QuantityTotals::addUnmeasured(const std::string& text) {
+    std::size_t first = text.find_first_not_of(" \t");
+    if (first == std::string::npos) {
+        return;
+    }
+    std::string trimmed = text.substr(first, text.find_last_not_of(" \t") + 1 - first);
+    for (std::size_t i = 0; i < unmeasured.size(); ++i) {
+        if (unmeasured[i].first == trimmed) {
+            unmeasured[i].second++;
+            return;
+        }
+    }
+    unmeasured.push_back(std::make_pair(trimmed, 1));
+}
+
+static void appendCount(std::ostringstream& oss, std::int64_t milliCount, Unit unit) {
+    oss << milliCount / 1000.0;
+    if (unit != Unit::Piece) oss << " " << unitToString(unit);
+}
+
+std::string QuantityTotals::toString() const {
+    std::ostringstream oss;
+    const char* separator = "";
+    if (milligrams != 0) {
+        oss << grams() << " g";
+        separator = " + ";
+    }
+    if (microliters != 0) {
+        oss << separator << milliliters() << " ml";
+        separator = " + ";
+    }
+    if (milliCount != 0) {
+        oss << separator;
+        appendCount(oss, milliCount, countUnit);
+        separator = " + ";
+    }
+    for (std::size_t i = 0; i < otherCounts.size(); ++i) {
+        if (otherCounts[i].second == 0) continue;
+        oss << separator;
+        appendCount(oss, otherCounts[i].second, otherCounts[i].first);
+        separator = " + ";
+    }
+    for (std::size_t i = 0; i < unmeasured.size(); ++i) {
+        oss << separator << unmeasured[i].first;
+        if (unmeasured[i].second > 1) oss << " (x" << unmeasured[i].second << ")";
+        separator = " + ";
+    }
+    return oss.str();
+}
+
+void QuantityColumns::reserve(std::size_t count) {
+    base.reserve(count);
+    kind.reserve(count);
+}
+
+void QuantityColumns::push(const Quantity& quantity, const std::string& text) {
+    UnitKind entryKind = quantity.kind();
+    if (entryKind == UnitKind::Count) {
+        if (countUnit == Unit::Unknown) {
+            countUnit = quantity.unit;
+        } else if (quantity.unit != countUnit) {
+            rest.addOtherCount(quantity.unit, quantity.base); // 2 cloves and 1 head do not add up
+            rest.summed++;
+            return;
+        }
+    }
+    if (entryKind == UnitKind::Unknown) {
+        rest.skipped++;
+        rest.addUnmeasured(text);
+        return;
+    }
+    base.push_back(quantity.base);
+    kind.push_back(static_cast<std::uint8_t>(entryKind));
+}
+
+// Masked integer sums with no data-dependent branches: each lane is
+// compare + and + add, so the loop vectorizes.
+QuantityTotals QuantityColumns::sum() const {
+    const std::uint8_t MASS = static_cast<std::uint8_t>(UnitKind::Mass);
+    const std::uint8_t VOLUME = static_cast<std::uint8_t>(UnitKind::Volume);
+    const std::uint8_t COUNT = static_cast<std::uint8_t>(UnitKind::Count);
+    const std::int32_t* values = base.data();
+    const std::uint8_t* kinds = kind.data();
+    const std::size_t n = base.size();
+
+    std::int64_t mass = 0, volume = 0, count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        std::int64_t value = values[i];
+        mass += value & -static_cast<std::int64_t>(kinds[i] == MASS);
+        volume += value & -static_cast<std::int64_t>(kinds[i] == VOLUME);
+        count += value & -static_cast<std::int64_t>(kinds[i] == COUNT);
+    }
+
+    QuantityTotals totals = rest;
+    totals.milligrams = mass;
+    totals.microliters = volume;
+    totals.milliCount = count;
+    totals.countUnit = countUnit;
+    totals.summed += static_cast<int>(n);
+    return totals;
+}
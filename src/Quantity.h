@@ -0,0 +1,100 @@
+// src/Quantity.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility> // For std::pair
+#include <vector>
+
+// Units understood by the quantity parser
+enum class Unit : std::uint8_t {
+    Unknown,    // Unrecognized text, e.g. "to taste"
+    Piece,      // Bare number, e.g. "2"
+    Milligram, Gram, Kilogram, Ounce, Pound,
+    Milliliter, Liter, Teaspoon, Tablespoon, Cup, FluidOunce, Pinch, Dash,
+    Clove, Slice, Strip, Sheet, Ball, Head, Can, Bunch, Sprig
+};
+
+enum class UnitKind : std::uint8_t { Unknown, Mass, Volume, Count };
+
+UnitKind unitKind(Unit unit);
+std::string unitToString(Unit unit); // Canonical short name ("g", "tbsp", "clove")
+
+// =============================
+// Parsed Ingredient Quantity
+// - Parsed once from text such as "200g", "1 tbsp", "1/2 cup", "2slices"
+// - Keeps the amount in its own unit plus the amount converted to integer
+//   milli-base units (mg, microlitres, thousandths of a count), so totals
+//   never re-parse or convert
+// - Count units (cloves, slices, ...) only add up with the same unit
+// =============================
+
+struct Quantity {
+    float amount;          // In 'unit'
+    std::int32_t base;     // Milli-base units; 0 when the unit is unknown
+    Unit unit;
+    std::uint8_t numberEnd; // Text offset just past the number; 0 if there was none
+
+    Quantity() : amount(0.0f), base(0), unit(Unit::Unknown), numberEnd(0) {}
+
+    // Texts longer than 255 characters are left unparsed (Unit::Unknown)
+    static Quantity parse(const std::string& text);
+    static Quantity parse(const char* text, std::size_t length);
+
+    UnitKind kind() const { return unitKind(unit); }
+    bool isKnown() const { return unit != Unit::Unknown; }
+
+    // Same unit, amount multiplied; unknown if the result is too large to total
+    Quantity scaled(double factor) const;
+
+    // Appends 'text' (which this was parsed from) with the number multiplied
+    // and the rest kept as written: "200g" x2 -> "400g", "pinch" x2 -> "2 pinch".
+    // Text without a number or unit ("to taste") is appended unchanged.
+    void appendScaledText(std::string& out, const std::string& text, double factor) const;
+};
+
+// Sum of many quantities of one ingredient. Nothing is dropped: count units
+// after the first one keep their own totals, and texts with no known unit
+// ("a dozen", "to taste") are kept as written.
+struct QuantityTotals {
+    std::int64_t milligrams;
+    std::int64_t microliters;
+    std::int64_t milliCount;
+    Unit countUnit;        // Unit of milliCount (first count unit seen)
+    std::vector<std::pair<Unit, std::int64_t> > otherCounts; // Later count units, milli-counts, in order seen
+    std::vector<std::pair<std::string, int> > unmeasured;     // Unparsed texts and how often each was added
+    int summed;            // Quantities with a known unit
+    int skipped;           // Quantities with no known unit
+
+    QuantityTotals() : milligrams(0), microliters(0), milliCount(0), countUnit(Unit::Unknown), summed(0), skipped(0) {}
+
+    double grams() const { return milligrams / 1000.0; }
+    double milliliters() const { return microliters / 1000.0; }
+    double count() const { return milliCount / 1000.0; }
+    // Running total, same rules as QuantityColumns. 'text' is what the
+    // quantity was parsed from; it is kept only when the unit is unknown.
+    void add(const Quantity& quantity, const std::string& text = std::string());
+    void addOtherCount(Unit unit, std::int64_t milliCount);
+    void addUnmeasured(const std::string& text); // Blank texts are not kept
+    std::string toString() const; // e.g. "350 g + 30 ml + 3 clove + 1 head + a dozen"
+};
+
+// Quantities gathered column-wise so sum() runs as one branch-free loop
+// over contiguous arrays, which the compiler vectorizes (GCC/Clang at -O3).
+class QuantityColumns {
+private:
+    std::vector<std::int32_t> base;
+    std::vector<std::uint8_t> kind;  // UnitKind per entry
+    Unit countUnit;
+    QuantityTotals rest;  // Other count units and unknown texts, outside the columns
+
+public:
+    QuantityColumns() : countUnit(Unit::Unknown) {}
+
+    void reserve(std::size_t count);
+    void push(const Quantity& quantity, const std::string& text = std::string());
+    std::size_t size() const { return base.size(); }
+
+    QuantityTotals sum() const;
+};
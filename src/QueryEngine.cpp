@@ -0,0 +1,417 @@
+// src/QueryEngine.cpp
+// Query parsing, planning and execution.
+#include "QueryEngine.h"
+#include "RecipeStore.h"
+#include "IngredientIndex.h"
+#include "TitleIndex.h"
+#include "BitmapIndex.h"
+#include "PrepTimeIndex.h"
+#include <algorithm> // For std::sort, std::binary_search
+#include <cctype>
+#include <climits>
+#include <cstdlib>   // For std::strtol
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+// --- Parsing ---
+namespace {
+    // Splits on spaces outside double quotes; the quotes themselves are dropped
+    std::vector<std::string> tokenize(const std::string& text) {
+        std::vector<std::string> tokens;
+        std::string token;
+        bool quoted = false;
+        bool inToken = false;
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            char c = text[i];
+            if (c == '"') {
+                quoted = !quoted;
+                inToken = true;
+            } else if (!quoted && (c == ' ' || c == '\t')) {
+                if (inToken) tokens.push_back(token);
+                token.clear();
+                inToken = false;
+            } else {
+                token.push_back(c);
+                inToken = true;
+            }
+        }
+        if (quoted) throw std::invalid_argument("Unterminated quote in query");
+        if (inToken) tokens.push_back(token);
+        return tokens;
+    }
+
+    std::string lowercase(const std::string& text) {
+        return TitleIndex::fold(text);
+    }
+
+    int parseNumber(const std::string& text, const std::string& term) {
+        char* end = nullptr;
+        long value = text.empty() ? 0 : std::strtol(text.c_str(), &end, 10);
+        if (text.empty() || *end != '\0' || value < 0 || value > 1000000) {
+            throw std::invalid_argument("Expected a number in query term: " + term);
+        }
+        return static_cast<int>(value);
+    }
+
+    bool comparePrepTime(int prepTime, QueryPredicate::Comparison comparison, int minutes) {
+        switch (comparison) {
+            case QueryPredicate::Less:         return prepTime < minutes;
+            case QueryPredicate::LessEqual:    return prepTime <= minutes;
+            case QueryPredicate::Equal:        return prepTime == minutes;
+            case QueryPredicate::GreaterEqual: return prepTime >= minutes;
+            default:                           return prepTime > minutes;
+        }
+    }
+
+    // Inclusive minute range matched by a prep-time comparison
+    void prepTimeRange(const QueryPredicate& predicate, int& minMinutes, int& maxMinutes) {
+        minMinutes = INT_MIN;
+        maxMinutes = INT_MAX;
+        switch (predicate.comparison) {
+            case QueryPredicate::Less:         maxMinutes = predicate.minutes - 1; break;
+            case QueryPredicate::LessEqual:    maxMinutes = predicate.minutes; break;
+            case QueryPredicate::Equal:        minMinutes = maxMinutes = predicate.minutes; break;
+            case QueryPredicate::GreaterEqual: minMinutes = predicate.minutes; break;
+            default:                           minMinutes = predicate.minutes + 1; break;
+        }
+    }
+
+    const char* comparisonToString(QueryPredicate::Comparison comparison) {
+        switch (comparison) {
+            case QueryPredicate::Less:         return "<";
+            case QueryPredicate::LessEqual:    return "<=";
+            case QueryPredicate::Equal:        return "=";
+            case QueryPredicate::GreaterEqual: return ">=";
+            default:                           return ">";
+        }
+    }
+
+    const char* sortKeyToString(Query::SortKey key) {
+        switch (key) {
+            case Query::ByTitle:    return "title";
+            case Query::ByPrepTime: return "prep";
+            case Query::ByMealType: return "meal";
+            default:                return "none";
+        }
+    }
+}
+
+std::string QueryPredicate::toString() const {
+    std::ostringstream oss;
+    if (negated) oss << "NOT ";
+    switch (kind) {
+        case Diet:       oss << "diet = " << dietTypeToString(diet); break;
+        case Meal:       oss << "meal = " << mealTypeToString(meal); break;
+        case PrepTime:   oss << "prep " << comparisonToString(comparison) << " " << minutes; break;
+        case Ingredient: oss << "ing = " << text; break;
+        case Title:      oss << "title ~ \"" << text << "\""; break;
+    }
+    return oss.str();
+}
+
+Query Query::parse(const std::string& text) {
+    Query query;
+    std::vector<std::string> tokens = tokenize(text);
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        const std::string& term = tokens[i];
+        if (i == 0 && lowercase(term) == "explain") {
+            query.explain = true;
+            continue;
+        }
+
+        QueryPredicate predicate;
+        std::string body = term;
+        if (body.size() > 1 && body[0] == '-') {
+            predicate.negated = true;
+            body = body.substr(1);
+        }
+
+        // prep<30, prep<=30, prep=30, prep>=30, prep>30
+        std::string lower = lowercase(body);
+        if (lower.compare(0, 4, "prep") == 0 && lower.size() > 4 && lower[4] != ':') {
+            std::size_t digits = 5;
+            if (lower[4] == '<') {
+                predicate.comparison = QueryPredicate::Less;
+            } else if (lower[4] == '>') {
+                predicate.comparison = QueryPredicate::Greater;
+            } else if (lower[4] == '=') {
+                predicate.comparison = QueryPredicate::Equal;
+            } else {
+                throw std::invalid_argument("Unknown comparison in query term: " + term);
+            }
+            if (lower.size() > 5 && lower[5] == '=' && lower[4] != '=') {
+                predicate.comparison = (lower[4] == '<') ? QueryPredicate::LessEqual : QueryPredicate::GreaterEqual;
+                digits = 6;
+            }
+            predicate.kind = QueryPredicate::PrepTime;
+            predicate.minutes = parseNumber(lower.substr(digits), term);
+            query.predicates.push_back(predicate);
+            continue;
+        }
+
+        std::size_t colon = body.find(':');
+        if (colon == std::string::npos || colon + 1 == body.size()) {
+            throw std::invalid_argument("Expected key:value in query term: " + term);
+        }
+        const std::string key = lowercase(body.substr(0, colon));
+        const std::string value = body.substr(colon + 1);
+        const std::string lowerValue = lowercase(value);
+
+        if (key == "diet") {
+            predicate.kind = QueryPredicate::Diet;
+            predicate.diet = stringToDietType(value);
+            if (predicate.diet == DietType::Other && lowerValue != "other") {
+                throw std::invalid_argument("Unknown diet type: " + value);
+            }
+        } else if (key == "meal") {
+            predicate.kind = QueryPredicate::Meal;
+            predicate.meal = stringToMealType(value);
+            if (predicate.meal == MealType::Other && lowerValue != "other") {
+                throw std::invalid_argument("Unknown meal type: " + value);
+            }
+        } else if (key == "ing") {
+            predicate.kind = QueryPredicate::Ingredient;
+            predicate.text = value;
+        } else if (key == "title") {
+            predicate.kind = QueryPredicate::Title;
+            predicate.text = value;
+        } else if (key == "sort" && !predicate.negated) {
+            if (lowerValue == "title") query.sortBy = ByTitle;
+            else if (lowerValue == "prep") query.sortBy = ByPrepTime;
+            else if (lowerValue == "meal") query.sortBy = ByMealType;
+            else throw std::invalid_argument("Unknown sort key: " + value);
+            continue;
+        } else if (key == "limit" && !predicate.negated) {
+            query.limit = static_cast<std::size_t>(parseNumber(value, term));
+            continue;
+        } else {
+            throw std::invalid_argument("Unknown query term: " + term);
+        }
+        query.predicates.push_back(predicate);
+    }
+    return query;
+}
+
+// --- Planning ---
+struct QueryEngine::BoundPredicate {
+    const QueryPredicate* predicate;
+    double matching;             // Estimated rows matching the positive predicate
+    const PostingList* postings; // Ingredient or title ids (sorted), if any
+    PostingList titleIds;        // Owned ids for a title predicate
+
+    double selectivity(double rows) const { // Fraction of rows that pass
+        if (rows <= 0) return 0.0;
+        double fraction = std::min(1.0, matching / rows);
+        return predicate->negated ? 1.0 - fraction : fraction;
+    }
+};
+
+void QueryEngine::bind(BoundPredicate& bound) const {
+    const QueryPredicate& predicate = *bound.predicate;
+    bound.postings = nullptr;
+    switch (predicate.kind) {
+        case QueryPredicate::Diet:
+            bound.matching = static_cast<double>(bitmapIndex.withDietType(predicate.diet).count());
+            break;
+        case QueryPredicate::Meal:
+            bound.matching = static_cast<double>(bitmapIndex.withMealType(predicate.meal).count());
+            break;
+        case QueryPredicate::Ingredient:
+            bound.postings = ingredientIndex.find(IngredientPool::instance().find(predicate.text));
+            bound.matching = bound.postings ? static_cast<double>(bound.postings->size()) : 0.0;
+            break;
+        case QueryPredicate::Title:
+            bound.titleIds = titleIndex.findSubstring(predicate.text);
+            bound.postings = &bound.titleIds;
+            bound.matching = static_cast<double>(bound.titleIds.size());
+            break;
+        case QueryPredicate::PrepTime: {
+            int minMinutes, maxMinutes;
+            prepTimeRange(predicate, minMinutes, maxMinutes);
+            bound.matching = static_cast<double>(prepTimeIndex.countRange(minMinutes, maxMinutes));
+            break;
+        }
+    }
+}
+
+PostingList QueryEngine::fetch(const BoundPredicate& bound) const {
+    const QueryPredicate& predicate = *bound.predicate;
+    switch (predicate.kind) {
+        case QueryPredicate::Diet:
+            return bitmapIndex.withDietType(predicate.diet).toPostingList();
+        case QueryPredicate::Meal:
+            return bitmapIndex.withMealType(predicate.meal).toPostingList();
+        case QueryPredicate::Ingredient:
+        case QueryPredicate::Title:
+            return bound.postings ? *bound.postings : PostingList();
+        case QueryPredicate::PrepTime:
+        default: {
+            int minMinutes, maxMinutes;
+            prepTimeRange(predicate, minMinutes, maxMinutes);
+            return prepTimeIndex.findRange(minMinutes, maxMinutes);
+        }
+    }
+}
+
+bool QueryEngine::matches(const BoundPredicate& bound, RecipeId id) const {
+    const QueryPredicate& predicate = *bound.predicate;
+    bool match = false;
+    switch (predicate.kind) {
+        case QueryPredicate::Diet:
+            match = bitmapIndex.withDietType(predicate.diet).test(id);
+            break;
+        case QueryPredicate::Meal:
+            match = bitmapIndex.withMealType(predicate.meal).test(id);
+            break;
+        case QueryPredicate::PrepTime:
+            match = comparePrepTime(store.getPrepTime(id), predicate.comparison, predicate.minutes);
+            break;
+        case QueryPredicate::Ingredient:
+        case QueryPredicate::Title:
+            match = bound.postings && std::binary_search(bound.postings->begin(), bound.postings->end(), id);
+            break;
+    }
+    return match != predicate.negated;
+}
+
+namespace {
+    // Index a predicate's ids come from; probes read the prep-time column instead
+    const char* accessPath(const QueryPredicate& predicate, bool probe) {
+        switch (predicate.kind) {
+            case QueryPredicate::Diet:
+            case QueryPredicate::Meal:       return "bitmap";
+            case QueryPredicate::Ingredient: return "ingredient postings";
+            case QueryPredicate::Title:      return "title n-grams";
+            default:                         return probe ? "prep-time column" : "prep-time index";
+        }
+    }
+
+    template <typename Key>
+    bool keyLess(const std::pair<Key, RecipeId>& a, const std::pair<Key, RecipeId>& b) {
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    }
+
+    // Orders ids by key (ties by id), keeping only the first 'limit' when set
+    template <typename Key>
+    void sortByKey(std::vector<std::pair<Key, RecipeId> >& keyed, std::vector<RecipeId>& ids, std::size_t limit) {
+        if (limit > 0 && limit < keyed.size()) {
+            std::partial_sort(keyed.begin(), keyed.begin() + limit, keyed.end(), keyLess<Key>);
+            keyed.resize(limit);
+        } else {
+            std::sort(keyed.begin(), keyed.end(), keyLess<Key>);
+        }
+        ids.clear();
+        for (std::size_t i = 0; i < keyed.size(); ++i) ids.push_back(keyed[i].second);
+    }
+}
+
+void QueryEngine::sortIds(std::vector<RecipeId>& ids, Query::SortKey key, std::size_t limit) const {
+    if (key == Query::ByTitle) {
+        std::vector<std::pair<std::string, RecipeId> > keyed;
+        for (std::size_t i = 0; i < ids.size(); ++i) keyed.push_back(std::make_pair(store.getTitle(ids[i]), ids[i]));
+        sortByKey(keyed, ids, limit);
+    } else {
+        std::vector<std::pair<int, RecipeId> > keyed;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            int value = (key == Query::ByPrepTime) ? store.getPrepTime(ids[i]) : static_cast<int>(store.getMealType(ids[i]));
+            keyed.push_back(std::make_pair(value, ids[i]));
+        }
+        sortByKey(keyed, ids, limit);
+    }
+}
+
+// --- Execution ---
+namespace {
+    bool moreSelective(const std::pair<double, std::size_t>& a, const std::pair<double, std::size_t>& b) {
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    }
+}
+
+QueryResult QueryEngine::run(const Query& query) const {
+    QueryResult result;
+    const double rows = static_cast<double>(store.size());
+
+    std::vector<BoundPredicate> bound(query.predicates.size());
+    for (std::size_t i = 0; i < bound.size(); ++i) {
+        bound[i].predicate = &query.predicates[i];
+        bind(bound[i]);
+    }
+
+    // The positive predicate with the fewest estimated rows drives the plan
+    std::size_t driver = bound.size();
+    for (std::size_t i = 0; i < bound.size(); ++i) {
+        if (!query.predicates[i].negated && (driver == bound.size() || bound[i].matching < bound[driver].matching)) {
+            driver = i;
+        }
+    }
+
+    PostingList candidates;
+    PlanStep fetchStep;
+    if (driver == bound.size()) {
+        candidates = bitmapIndex.all().toPostingList();
+        fetchStep.operation = "Scan all recipes (bitmap)";
+        fetchStep.estimated = rows;
+    } else {
+        candidates = fetch(bound[driver]);
+        fetchStep.operation = "Fetch " + query.predicates[driver].toString() + " (" + accessPath(query.predicates[driver], false) + ")";
+        fetchStep.estimated = bound[driver].matching;
+    }
+    fetchStep.actual = candidates.size();
+    result.plan.push_back(fetchStep);
+
+    // Remaining predicates filter the stream, most selective first
+    std::vector<std::pair<double, std::size_t> > order;
+    for (std::size_t i = 0; i < bound.size(); ++i) {
+        if (i != driver) order.push_back(std::make_pair(bound[i].selectivity(rows), i));
+    }
+    std::sort(order.begin(), order.end(), moreSelective);
+
+    double estimated = fetchStep.estimated;
+    std::vector<std::size_t> passed(order.size(), 0);
+    const std::size_t streamLimit = (query.sortBy == Query::None) ? query.limit : 0;
+    for (std::size_t c = 0; c < candidates.size(); ++c) {
+        if (streamLimit > 0 && result.ids.size() >= streamLimit) break; // Early stop
+        std::size_t f = 0;
+        while (f < order.size() && matches(bound[order[f].second], candidates[c])) {
+            passed[f++]++;
+        }
+        if (f == order.size()) result.ids.push_back(candidates[c]);
+    }
+    for (std::size_t f = 0; f < order.size(); ++f) {
+        estimated *= order[f].first;
+        PlanStep step = { "Filter " + query.predicates[order[f].second].toString() +
+                          " (" + accessPath(query.predicates[order[f].second], true) + " probe)", estimated, passed[f] };
+        result.plan.push_back(step);
+    }
+
+    if (query.sortBy != Query::None) {
+        sortIds(result.ids, query.sortBy, query.limit);
+        PlanStep step = { std::string("Sort by ") + sortKeyToString(query.sortBy) +
+                          (query.limit > 0 ? " (top " + std::to_string(query.limit) + ")" : ""),
+                          query.limit > 0 ? std::min(estimated, static_cast<double>(query.limit)) : estimated,
+                          result.ids.size() };
+        result.plan.push_back(step);
+    }
+    if (query.limit > 0) {
+        if (result.ids.size() > query.limit) result.ids.resize(query.limit);
+        PlanStep step = { "Limit " + std::to_string(query.limit) +
+                          (streamLimit > 0 ? " (stops the stream early)" : ""),
+                          std::min(estimated, static_cast<double>(query.limit)), result.ids.size() };
+        result.plan.push_back(step);
+    }
+    return result;
+}
+
+std::string QueryResult::explain() const {
+    std::ostringstream oss;
+    oss << std::left << std::setw(5) << "Step" << std::setw(56) << "Operation"
+        << std::right << std::setw(11) << "Est. rows" << std::setw(13) << "Actual rows" << "\n";
+    for (std::size_t i = 0; i < plan.size(); ++i) {
+        oss << std::left << std::setw(5) << i + 1 << std::setw(56) << plan[i].operation
+            << std::right << std::setw(11) << std::fixed << std::setprecision(0) << plan[i].estimated
+            << std::setw(13) << plan[i].actual << "\n";
+    }
+    return oss.str();
+}
@@ -0,0 +1,101 @@
+// src/QueryEngine.h
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Recipe.h"
+#include "PostingList.h"
+
+class RecipeStore;
+class IngredientIndex;
+class TitleIndex;
+class BitmapIndex;
+class PrepTimeIndex;
+
+// One condition of a query
+struct QueryPredicate {
+    enum Kind { Diet, Meal, PrepTime, Ingredient, Title };
+    enum Comparison { Less, LessEqual, Equal, GreaterEqual, Greater };
+
+    Kind kind;
+    bool negated;           // "-ing:tofu"
+    DietType diet;
+    MealType meal;
+    Comparison comparison;  // For PrepTime
+    int minutes;
+    std::string text;       // Ingredient name or title fragment
+
+    QueryPredicate() : kind(Diet), negated(false), diet(DietType::Other), meal(MealType::Other),
+                       comparison(LessEqual), minutes(0) {}
+    std::string toString() const; // e.g. "prep < 30", "NOT ing = tofu"
+};
+
+// A parsed query
+struct Query {
+    enum SortKey { None, ByTitle, ByPrepTime, ByMealType };
+
+    std::vector<QueryPredicate> predicates;
+    SortKey sortBy;
+    std::size_t limit;  // 0 for no limit
+    bool explain;
+
+    Query() : sortBy(None), limit(0), explain(false) {}
+
+    // Terms separated by spaces; values with spaces go in double quotes:
+    //   [EXPLAIN] diet:vegan meal:dinner prep<30 ing:spinach -ing:tofu
+    //             title:"green curry" sort:prep limit:20
+    // prep takes <, <=, =, >= or >. Throws std::invalid_argument on bad input.
+    static Query parse(const std::string& text);
+};
+
+// One step of an executed plan, with the planner's estimate next to what
+// actually came out of the step
+struct PlanStep {
+    std::string operation;
+    double estimated;
+    std::size_t actual;
+};
+
+struct QueryResult {
+    std::vector<RecipeId> ids;   // Matches in the requested order
+    std::vector<PlanStep> plan;
+
+    std::string explain() const; // Plan table with estimated vs actual rows
+};
+
+// =============================
+// Query Engine with a cost-based planner
+// - Every positive predicate gets a cardinality estimate from its index:
+//   exact posting-list, bitmap and prep-time range sizes
+// - The smallest estimate drives the plan (its ids are fetched from the
+//   index); the other predicates then filter that stream, most selective
+//   first, each as a per-id index probe
+// - Filter estimates assume independence: rows x the predicate's selectivity
+// - Without a sort, a limit stops the stream early
+// =============================
+
+class QueryEngine {
+private:
+    const RecipeStore& store;
+    const IngredientIndex& ingredientIndex;
+    const TitleIndex& titleIndex;
+    const BitmapIndex& bitmapIndex;
+    const PrepTimeIndex& prepTimeIndex;
+
+    struct BoundPredicate; // A predicate with its estimate and resolved index data
+
+    void bind(BoundPredicate& bound) const;
+    PostingList fetch(const BoundPredicate& bound) const;
+    bool matches(const BoundPredicate& bound, RecipeId id) const;
+    void sortIds(std::vector<RecipeId>& ids, Query::SortKey key, std::size_t limit) const;
+
+public:
+    QueryEngine(const RecipeStore& store, const IngredientIndex& ingredientIndex,
+                const TitleIndex& titleIndex, const BitmapIndex& bitmapIndex, const PrepTimeIndex& prepTimeIndex)
+        : store(store), ingredientIndex(ingredientIndex), titleIndex(titleIndex), bitmapIndex(bitmapIndex),
+          prepTimeIndex(prepTimeIndex) {}
+
+    QueryResult run(const Query& query) const;
+    QueryResult run(const std::string& text) const { return run(Query::parse(text)); }
+};
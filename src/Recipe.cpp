@@ -5,11 +5,12 @@
 #include "VeganRecipe.h"
 #include "VegetarianRecipe.h"
 #include "OmnivoreRecipe.h"
+#include "RecipeParser.h"
 #include <stdexcept> // For invalid_argument
-#include <algorithm> // For std::transform
 #include <cctype>    // For ::tolower
 #include <unordered_set>
 #include <sstream>
+#include <utility>  // For std::move
 
 // --- Helper Enum Functions --- 
 
@@ -26,15 +27,29 @@ std::string mealTypeToString(MealType type) {
     }
 }
 
+// Case-insensitive comparison of a character range against a lowercase literal.
+static bool equalsIgnoreCase(const char* text, std::size_t length, const char* lowerLiteral) {
+    std::size_t i = 0;
+    for (; i < length && lowerLiteral[i] != '\0'; ++i) {
+        if (std::tolower(static_cast<unsigned char>(text[i])) != lowerLiteral[i]) {
+            return false;
+        }
+    }
+    return i == length && lowerLiteral[i] == '\0';
+}
+
 // Converts a string to the corresponding MealType enum value (case-insensitive).
 MealType stringToMealType(const std::string& str) {
-    std::string lowerStr = str;
-    std::transform(lowerStr.begin(), lowerStr.end(), lowerStr.begin(), ::tolower);
-    if (lowerStr == "breakfast") return MealType::Breakfast;
-    if (lowerStr == "lunch") return MealType::Lunch;
-    if (lowerStr == "dinner") return MealType::Dinner;
-    if (lowerStr == "snack") return MealType::Snack;
-    if (lowerStr == "dessert") return MealType::Dessert;
+    return stringToMealType(str.data(), str.size());
+}
+
+// Same as above for a character range, without allocating.
+MealType stringToMealType(const char* text, std::size_t length) {
+    if (equalsIgnoreCase(text, length, "breakfast")) return MealType::Breakfast;
+    if (equalsIgnoreCase(text, length, "lunch")) return MealType::Lunch;
+    if (equalsIgnoreCase(text, length, "dinner")) return MealType::Dinner;
+    if (equalsIgnoreCase(text, length, "snack")) return MealType::Snack;
+    if (equalsIgnoreCase(text, length, "dessert")) return MealType::Dessert;
     return MealType::Other;
 }
 
@@ -51,11 +66,14 @@ std::string dietTypeToString(DietType type) {
 
 // Converts a string to the corresponding DietType enum value (case-insensitive).
 DietType stringToDietType(const std::string& str) {
-    std::string lowerStr = str;
-    std::transform(lowerStr.begin(), lowerStr.end(), lowerStr.begin(), ::tolower);
-    if (lowerStr == "vegetarian") return DietType::Vegetarian;
-    if (lowerStr == "vegan") return DietType::Vegan;
-    if (lowerStr == "omnivore") return DietType::Omnivore;
+    return stringToDietType(str.data(), str.size());
+}
+
+// Same as above for a character range, without allocating.
+DietType stringToDietType(const char* text, std::size_t length) {
+    if (equalsIgnoreCase(text, length, "vegetarian")) return DietType::Vegetarian;
+    if (equalsIgnoreCase(text, length, "vegan")) return DietType::Vegan;
+    if (equalsIgnoreCase(text, length, "omnivore")) return DietType::Omnivore;
     return DietType::Other;
 }
 
@@ -63,44 +81,102 @@ DietType stringToDietType(const std::string& str) {
 // --- Recipe Class Implementation ---
 
 // Static member for global ingredient blacklist shared by all Recipe instances.
-std::unordered_set<std::string> Recipe::blacklistedIngredients;
+std::unordered_set<IngredientId> Recipe::blacklistedIngredients;
 
 // Constructor: Initializes a Recipe with title, prep time, meal type, and diet type.
-Recipe::Recipe(const std::string& title, int prepTime, MealType mealType, DietType dietType)
-    : title(title), prepTime(prepTime), mealType(mealType), dietType(dietType) {}
+Recipe::Recipe(std::string title, int prepTime, MealType mealType, DietType dietType)
+    : title(std::move(title)), prepTime(prepTime), mealType(mealType), dietType(dietType),
+      id(INVALID_RECIPE_ID), listener(nullptr) {
+    if (!isValidTitle(this->title)) {
+        throw std::invalid_argument("Recipe title cannot contain '|' or line breaks: " + this->title);
+    }
+}
+
+// Destructor: Lets the owning store drop the recipe before it goes away.
+Recipe::~Recipe() {
+    if (listener) {
+        listener->onRecipeRemoved(*this);
+    }
+}
 
-// Copy constructor: Deep copies all fields, including the linked list of ingredients.
-Recipe::Recipe(const Recipe& copy) {
-    this->title = copy.title;
-    this->prepTime = copy.prepTime;
-    this->mealType = copy.mealType;
-    this->dietType = copy.dietType;
-    this->ingredients = copy.ingredients;
+// Copy constructor: Deep copies all fields, including the ingredient list.
+// The copy is not part of any store.
+Recipe::Recipe(const Recipe& copy)
+    : title(copy.title), prepTime(copy.prepTime), ingredients(copy.ingredients),
+      mealType(copy.mealType), dietType(copy.dietType), id(INVALID_RECIPE_ID), listener(nullptr) {}
+
+// Move constructor: Steals the title and ingredients unless the source
+// belongs to a store, in which case they are copied.
+Recipe::Recipe(Recipe&& other)
+    : prepTime(other.prepTime), mealType(other.mealType), dietType(other.dietType),
+      id(INVALID_RECIPE_ID), listener(nullptr) {
+    if (other.listener) {
+        this->title = other.title;
+        this->ingredients = other.ingredients;
+    } else {
+        this->title = std::move(other.title);
+        this->ingredients = std::move(other.ingredients);
+    }
 }
 
 // Copy assignment operator: Ensures deep copy and self-assignment safety.
+// Keeps this recipe's id and store.
 Recipe& Recipe::operator=(const Recipe& copy) {
     if (this != &copy) {
-        this->title = copy.title;
-        this->prepTime = copy.prepTime;
-        this->mealType = copy.mealType;
-        this->dietType = copy.dietType;
-        this->ingredients = copy.ingredients;
+        assign(copy.title, copy.prepTime, copy.mealType, copy.dietType, copy.ingredients);
     }
     return *this;
 }
 
+// Move assignment operator: Same as above, stealing from a detached source.
+Recipe& Recipe::operator=(Recipe&& other) {
+    if (this != &other) {
+        if (other.listener) {
+            return *this = static_cast<const Recipe&>(other);
+        }
+        assign(std::move(other.title), other.prepTime, other.mealType, other.dietType, std::move(other.ingredients));
+    }
+    return *this;
+}
+
+void Recipe::assign(std::string title, int prepTime, MealType mealType, DietType dietType, IngredientList ingredients) {
+    if (!listener) {
+        this->title = std::move(title);
+        this->prepTime = prepTime;
+        this->mealType = mealType;
+        this->dietType = dietType;
+        this->ingredients = std::move(ingredients);
+        return;
+    }
+    setTitle(title);
+    setPrepTime(prepTime);
+    setMealType(mealType);
+    setDietType(dietType);
+    IngredientList previous(std::move(this->ingredients));
+    this->ingredients = std::move(ingredients);
+    for (IngredientList::const_iterator it = previous.begin(); it != previous.end(); ++it) {
+        listener->onIngredientRemoved(*this, *it);
+    }
+    for (IngredientList::const_iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
+        listener->onIngredientAdded(*this, *it);
+    }
+}
+
 // --- Getters ---
 // Returns the recipe title.
 std::string Recipe::getTitle() const {
     return title;
 }
+
+bool Recipe::isValidTitle(const std::string& title) {
+    return title.find_first_of("|\r\n") == std::string::npos;
+}
 // Returns the preparation time in minutes.
 int Recipe::getPrepTime() const {
     return prepTime;
 }
-// Returns a const reference to the linked list of ingredients.
-const LinkedList<Ingredient>& Recipe::getIngredients() const {
+// Returns a const reference to the ingredient list.
+const IngredientList& Recipe::getIngredients() const {
     return ingredients;
 }
 // Returns the meal type.
@@ -111,25 +187,52 @@ MealType Recipe::getMealType() const {
 DietType Recipe::getDietType() const {
     return dietType;
 }
+// Returns the store-assigned id (INVALID_RECIPE_ID when not in a store).
+RecipeId Recipe::getId() const {
+    return id;
+}
+
+// --- Store Membership ---
+// Registers the listener to be notified of changes under the given id.
+void Recipe::attach(RecipeListener* listener, RecipeId id) {
+    this->listener = listener;
+    this->id = id;
+}
+// Stops change notifications and clears the id.
+void Recipe::detach() {
+    this->listener = nullptr;
+    this->id = INVALID_RECIPE_ID;
+}
 
 // --- Setters ---
 // Sets the recipe title.
 void Recipe::setTitle(const std::string& title) {
+    if (!isValidTitle(title)) {
+        throw std::invalid_argument("Recipe title cannot contain '|' or line breaks: " + title);
+    }
+    std::string oldTitle = this->title;
     this->title = title;
+    if (listener) listener->onTitleChanged(*this, oldTitle);
 }
 // Sets the preparation time (must be non-negative).
 void Recipe::setPrepTime(int prepTime) {
     if (prepTime >= 0) { // Basic validation
+        int oldPrepTime = this->prepTime;
         this->prepTime = prepTime;
+        if (listener) listener->onPrepTimeChanged(*this, oldPrepTime);
     }
 }
 // Sets the meal type.
 void Recipe::setMealType(MealType type) {
+    MealType oldType = this->mealType;
     this->mealType = type;
+    if (listener) listener->onMealTypeChanged(*this, oldType);
 }
 // Sets the diet type.
 void Recipe::setDietType(DietType type) {
+    DietType oldType = this->dietType;
     this->dietType = type;
+    if (listener) listener->onDietTypeChanged(*this, oldType);
 }
 
 // Checks if the recipe title matches the given string (exact match).
@@ -139,9 +242,13 @@ bool Recipe::matchesTitle(std::string title) const {
 
 // Checks if the recipe contains an ingredient with the given name.
 bool Recipe::matchesIngredient(std::string ingredient) const {
-    for (LinkedList<Ingredient>::const_iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
-        const Ingredient& ing = *it;
-        if (ing.getName() == ingredient) {
+    IngredientId id = IngredientPool::instance().find(ingredient);
+    return id != INVALID_INGREDIENT_ID && matchesIngredient(id);
+}
+
+bool Recipe::matchesIngredient(IngredientId id) const {
+    for (IngredientList::const_iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
+        if (it->getId() == id) {
             return true;
         }
     }
@@ -151,24 +258,29 @@ bool Recipe::matchesIngredient(std::string ingredient) const {
 // --- Ingredient Management Methods ---
 // Adds an ingredient to the recipe after validation (OOP: uses polymorphic validateIngredient).
 void Recipe::addIngredient(const Ingredient& ingredient) {
-    for (LinkedList<Ingredient>::iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
-        const Ingredient& ing = *it;
-        if (ing.getName() == ingredient.getName()) {
-            throw std::invalid_argument("Ingredient already exists: " + ingredient.getName());
-        }
+    addIngredient(Ingredient(ingredient));
+}
+
+void Recipe::addIngredient(Ingredient&& ingredient) {
+    if (matchesIngredient(ingredient.getId())) {
+        throw std::invalid_argument("Ingredient already exists: " + ingredient.getName());
     }
     if (validateIngredient(ingredient)) {
-        this->ingredients.push_back(Ingredient(ingredient));
+        this->ingredients.push_back(std::move(ingredient));
+        if (listener) listener->onIngredientAdded(*this, *this->ingredients.rbegin());
     } else {
         throw std::invalid_argument("Invalid ingredient for this recipe type: " + ingredient.getName());
     }
 }
 
-// Removes an ingredient by name (linear search and remove using custom linked list).
+// Removes an ingredient by name (linear search, then erase at the found position).
 void Recipe::removeIngredient(const std::string& ingredientName) {
-    for (LinkedList<Ingredient>::iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
-        if (it->getName() == ingredientName) {
-            this->ingredients.remove(*it);
+    IngredientId id = IngredientPool::instance().find(ingredientName);
+    for (IngredientList::iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
+        if (it->getId() == id) {
+            Ingredient removed = std::move(*it);
+            this->ingredients.erase(it);
+            if (listener) listener->onIngredientRemoved(*this, removed);
             break;
         }
     }
@@ -176,9 +288,16 @@ void Recipe::removeIngredient(const std::string& ingredientName) {
 
 // Edits an existing ingredient by replacing it with a new one (by name).
 void Recipe::editIngredient(const std::string& oldName, const Ingredient& newIngredient) {
-    for (LinkedList<Ingredient>::iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
-        if (it->getName() == oldName) {
+    IngredientId id = IngredientPool::instance().find(oldName);
+    for (IngredientList::iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
+        if (it->getId() == id) {
+            // Renaming onto another ingredient of this recipe would leave a duplicate
+            if (newIngredient.getId() != id && matchesIngredient(newIngredient.getId())) {
+                throw std::invalid_argument("Ingredient already exists: " + newIngredient.getName());
+            }
+            Ingredient previous = *it;
             *it = newIngredient;
+            if (listener) listener->onIngredientEdited(*this, previous, newIngredient);
             break;
         }
     }
@@ -187,28 +306,29 @@ void Recipe::editIngredient(const std::string& oldName, const Ingredient& newIng
 // --- Blacklist Management (Static) ---
 // Adds an ingredient to the global blacklist (case-insensitive).
 void Recipe::addToBlacklist(const std::string& ingredient) {
-    std::string lowerIngredient = ingredient;
-    std::transform(lowerIngredient.begin(), lowerIngredient.end(), lowerIngredient.begin(), ::tolower);
-    blacklistedIngredients.insert(lowerIngredient);
+    blacklistedIngredients.insert(IngredientPool::instance().intern(ingredient).id);
 }
 // Removes an ingredient from the global blacklist (case-insensitive).
 void Recipe::removeFromBlacklist(const std::string& ingredient) {
-    std::string lowerIngredient = ingredient;
-    std::transform(lowerIngredient.begin(), lowerIngredient.end(), lowerIngredient.begin(), ::tolower);
-    blacklistedIngredients.erase(lowerIngredient);
+    blacklistedIngredients.erase(IngredientPool::instance().find(ingredient));
 }
 // Checks if an ingredient is blacklisted (case-insensitive).
 bool Recipe::isBlacklisted(const std::string& ingredient) {
-    std::string lowerIngredient = ingredient;
-    std::transform(lowerIngredient.begin(), lowerIngredient.end(), lowerIngredient.begin(), ::tolower);
-    return blacklistedIngredients.find(lowerIngredient) != blacklistedIngredients.end();
+    if (blacklistedIngredients.empty()) {
+        return false; // Common case: skip the pool lookup
+    }
+    return isBlacklisted(IngredientPool::instance().find(ingredient));
+}
+
+bool Recipe::isBlacklisted(IngredientId id) {
+    return !blacklistedIngredients.empty() && blacklistedIngredients.count(id) != 0;
 }
 
 // --- Ingredient Validation ---
 // Validates an ingredient for this recipe (checks blacklist and diet rules).
 bool Recipe::validateIngredient(const Ingredient& ingredient) const {
     // Check if ingredient is blacklisted
-    if (isBlacklisted(ingredient.getName())) {
+    if (isBlacklisted(ingredient.getId())) {
         return false;
     }
     
@@ -228,7 +348,7 @@ std::string Recipe::serialize() const {
     
     // Serialize ingredients
     bool first = true;
-    for (LinkedList<Ingredient>::const_iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
+    for (IngredientList::const_iterator it = this->ingredients.begin(); it != this->ingredients.end(); ++it) {
         const Ingredient& ing = *it;
         if (!first) oss << ";";
         oss << ing.getName() << ":" << ing.getQuantity();
@@ -239,43 +359,7 @@ std::string Recipe::serialize() const {
 }
 
 // Deserializes a recipe from a string, reconstructing the correct derived type and all ingredients.
+// Throws ParseError (a std::runtime_error) on malformed input.
 Recipe* Recipe::deserialize(const std::string& data) {
-    std::istringstream iss(data);
-    std::string type, title, mealTypeStr, dietTypeStr, ingredientsStr;
-    int prepTime;
-    
-    // Parse the main recipe data
-    std::getline(iss, type, '|');
-    std::getline(iss, title, '|');
-    iss >> prepTime;
-    iss.ignore(); // Skip the '|'
-    std::getline(iss, mealTypeStr, '|');
-    std::getline(iss, dietTypeStr, '|');
-    std::getline(iss, ingredientsStr);
-    
-    // Create the appropriate recipe type
-    Recipe* recipe = nullptr;
-    if (type == "Vegan") {
-        recipe = new VeganRecipe(title, prepTime, stringToMealType(mealTypeStr));
-    } else if (type == "Vegetarian") {
-        recipe = new VegetarianRecipe(title, prepTime, stringToMealType(mealTypeStr));
-    } else if (type == "Omnivore") {
-        recipe = new OmnivoreRecipe(title, prepTime, stringToMealType(mealTypeStr));
-    } else {
-        throw std::runtime_error("Unknown recipe type: " + type);
-    }
-    
-    // Parse and add ingredients
-    std::istringstream ingredientsStream(ingredientsStr);
-    std::string ingredientPair;
-    while (std::getline(ingredientsStream, ingredientPair, ';')) {
-        size_t colonPos = ingredientPair.find(':');
-        if (colonPos != std::string::npos) {
-            std::string name = ingredientPair.substr(0, colonPos);
-            std::string quantity = ingredientPair.substr(colonPos + 1);
-            recipe->addIngredient(Ingredient(name, quantity));
-        }
-    }
-    
-    return recipe;
+    return RecipeParser::parseLine(data.data(), data.data() + data.size(), 1);
 }
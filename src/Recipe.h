@@ -4,56 +4,89 @@
 #include <string>
 #include "Ingredient.h"
 #include "LinkedList.h"
+#include "SmallList.h"
 #include "MealType.h"
 #include "DietType.h"
+#include "RecipeListener.h"
 #include <unordered_set>
 
+// Stable identifier assigned by the RecipeStore a recipe belongs to
+typedef int RecipeId;
+const RecipeId INVALID_RECIPE_ID = -1;
+
+// A recipe's ingredients: most recipes have fewer than 8, which fit inline
+// (8 x 24-byte Ingredients; benchIngredientLists reports the measured footprint)
+typedef SmallList<Ingredient, 8> IngredientList;
+
 // Helper functions
 std::string mealTypeToString(MealType type);
 MealType stringToMealType(const std::string& str);
+MealType stringToMealType(const char* text, std::size_t length); // Allocation-free
 
 std::string dietTypeToString(DietType type);
 DietType stringToDietType(const std::string& str);
+DietType stringToDietType(const char* text, std::size_t length); // Allocation-free
 
 // Recipe class
 class Recipe {
 protected:
     std::string title;
     int prepTime; // Preparation time in minutes
-    LinkedList<Ingredient> ingredients;
+    IngredientList ingredients;
     MealType mealType;
     DietType dietType;
-    static std::unordered_set<std::string> blacklistedIngredients; // Static blacklist shared across all recipes
+    static std::unordered_set<IngredientId> blacklistedIngredients; // Static blacklist shared across all recipes
+    RecipeId id;                // INVALID_RECIPE_ID until added to a store
+    RecipeListener* listener;   // Notified of changes (non-owning, may be null)
+
+    // Replaces all fields; a store the recipe belongs to is notified
+    void assign(std::string title, int prepTime, MealType mealType, DietType dietType, IngredientList ingredients);
 
 public:
-    // Constructor
-    Recipe(const std::string& title = "", 
+    // Constructor (the title is taken by value and moved in). Throws
+    // invalid_argument for a title that isValidTitle rejects.
+    Recipe(std::string title = "", 
            int prepTime = 0, 
            MealType mealType = MealType::Other, 
            DietType dietType = DietType::Other);
 
-    // Virtual destructor is crucial for base classes with virtual functions
-    virtual ~Recipe() = default;
+    // Virtual destructor is crucial for base classes with virtual functions.
+    // Notifies the listener so stores never hold a dangling recipe.
+    virtual ~Recipe();
 
-    // Copy constructors for Rule of Three
+    // Copies and moves carry the recipe's data, never its id or store
+    // membership. Moving out of a recipe that belongs to a store copies
+    // instead, so the store never sees fields change without a notification.
+    // Assigning to a recipe in a store notifies it like the setters do.
     Recipe(const Recipe& copy);
+    Recipe(Recipe&& other);
     Recipe& operator=(const Recipe& copy);
+    Recipe& operator=(Recipe&& other);
 
     // Abstract display method
     virtual void display() const = 0;
 
     // Getters
     std::string getTitle() const;
+    // Titles sit between '|' delimiters on one catalog line (see serialize),
+    // so '|' and line breaks are not allowed
+    static bool isValidTitle(const std::string& title);
     int getPrepTime() const;
-    const LinkedList<Ingredient>& getIngredients() const; // Return const ref
+    const IngredientList& getIngredients() const; // Return const ref
     MealType getMealType() const;
     DietType getDietType() const;
+    RecipeId getId() const;
+
+    // Store membership (used by RecipeStore; copies are never attached)
+    void attach(RecipeListener* listener, RecipeId id);
+    void detach();
 
     // Setters (basic ones)
-    void setTitle(const std::string& title);
+    void setTitle(const std::string& title); // Throws invalid_argument, like the constructor
     void setPrepTime(int prepTime);
     // Ingredient management methods
     void addIngredient(const Ingredient& ingredient);
+    void addIngredient(Ingredient&& ingredient); // For temporaries (load paths)
     void removeIngredient(const std::string& ingredientName);
     void editIngredient(const std::string& oldName, const Ingredient& newIngredient);
     
@@ -62,12 +95,14 @@ public:
     
     // Search methods
     bool matchesTitle(std::string title) const;
-    bool matchesIngredient(std::string ingredient) const;
+    bool matchesIngredient(std::string ingredient) const; // Case-insensitive
+    bool matchesIngredient(IngredientId id) const;
 
     // Ingredient validation methods
     static void addToBlacklist(const std::string& ingredient);
     static void removeFromBlacklist(const std::string& ingredient);
     static bool isBlacklisted(const std::string& ingredient);
+    static bool isBlacklisted(IngredientId id);
     bool validateIngredient(const Ingredient& ingredient) const;
     virtual bool isValidForDiet(const Ingredient& ingredient) const = 0; // Pure virtual method for diet-specific validation
 
@@ -89,7 +124,5 @@ public:
         return static_cast<int>(a->getMealType()) < static_cast<int>(b->getMealType());
     }
 
-    // TODO: Add ingredient blacklist filtering
-    // TODO: Add file I/O for recipe persistence
     // TODO: Add recipe categories and tags
 };
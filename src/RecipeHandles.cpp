@@ -0,0 +1,61 @@
+// src/RecipeHandles.cpp
+// Implementation of the recipe id -> list position handles.
+#include "RecipeHandles.h"
+
+RecipeHandles::RecipeHandles(LinkedList<Recipe*>& list) : list(list), valid(true) {}
+
+// One pass over the list; recipes that are not in a store are skipped
+void RecipeHandles::rebuild() {
+    handles.assign(handles.size(), list.end());
+    for (Handle it = list.begin(); it != list.end(); ++it) {
+        RecipeId id = (*it)->getId();
+        if (id == INVALID_RECIPE_ID) continue;
+        if (static_cast<std::size_t>(id) >= handles.size()) {
+            handles.resize(static_cast<std::size_t>(id) + 1, list.end());
+        }
+        handles[id] = it;
+    }
+    valid = true;
+}
+
+bool RecipeHandles::erase(const Recipe& recipe) {
+    RecipeId id = recipe.getId();
+    if (id == INVALID_RECIPE_ID) {
+        return false;
+    }
+    std::size_t slot = static_cast<std::size_t>(id);
+    // A handle that no longer points at this recipe means the list changed
+    // behind our back: rebuild once and look again
+    if (!valid || slot >= handles.size() || handles[slot] == list.end() || *handles[slot] != &recipe) {
+        rebuild();
+        if (slot >= handles.size() || handles[slot] == list.end() || *handles[slot] != &recipe) {
+            return false;
+        }
+    }
+    list.erase(handles[slot]);
+    handles[slot] = list.end();
+    return true;
+}
+
+// --- RecipeListener Hooks ---
+void RecipeHandles::onRecipeAdded(const Recipe& recipe) {
+    if (!valid) {
+        return; // The next erase rebuilds everything
+    }
+    std::size_t slot = static_cast<std::size_t>(recipe.getId());
+    if (slot >= handles.size()) {
+        handles.resize(slot + 1, list.end());
+    }
+    if (!list.isEmpty() && *(--list.end()) == &recipe) {
+        handles[slot] = --list.end(); // Common case: just pushed
+    } else {
+        valid = false;
+    }
+}
+
+void RecipeHandles::onRecipeRemoved(const Recipe& recipe) {
+    std::size_t slot = static_cast<std::size_t>(recipe.getId());
+    if (slot < handles.size()) {
+        handles[slot] = list.end();
+    }
+}
@@ -0,0 +1,41 @@
+// src/RecipeHandles.h
+#pragma once
+
+#include <vector>
+#include "RecipeListener.h"
+#include "LinkedList.h"
+#include "Recipe.h"
+
+// =============================
+// Recipe Handles (id -> list position)
+// - Remembers where each stored recipe sits in the catalog list, so it can
+//   be unlinked with LinkedList::erase in O(1) instead of a remove() scan
+// - Maintained as a RecipeStore listener: a recipe added right after being
+//   pushed onto the list is found at the tail; anything else (e.g. the
+//   replay when the listener is attached) marks the handles stale, and the
+//   next erase rebuilds them in one pass over the list
+// - Handles stay valid while the list is relinked (sorts, splices), since
+//   list nodes never move
+// =============================
+
+class RecipeHandles : public RecipeListener {
+private:
+    typedef LinkedList<Recipe*>::iterator Handle;
+
+    LinkedList<Recipe*>& list;
+    std::vector<Handle> handles; // By RecipeId; end() when not known
+    bool valid;
+
+    void rebuild();
+
+public:
+    explicit RecipeHandles(LinkedList<Recipe*>& list);
+
+    // Unlinks the recipe from the list without deleting it. Returns false if
+    // it is not in the list.
+    bool erase(const Recipe& recipe);
+
+    // RecipeListener hooks
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+};
@@ -0,0 +1,551 @@
+// src/RecipeJournal.cpp
+// Implementation of the write-ahead recipe journal.
+#include "RecipeJournal.h"
+#include "Checksum.h"
+#include "FileSync.h"
+#include "MappedFile.h"
+#include <chrono>
+#include <cstring>   // For std::memcpy, std::memcmp
+#include <iostream>
+#include <stdexcept>
+
+// On-disk layout (little-endian host order, like the binary catalog):
+//   header: "RCPJ" | version u32 | snapshotChecksum u32 | baseCount u32 |
+//           baseIds i32[baseCount] | headerChecksum u32
+//   record: payloadLength u32 | checksum u32 (over op + payload) | op u8 | payload
+// Strings in payloads are a u32 length followed by the bytes.
+namespace {
+    const char MAGIC[4] = { 'R', 'C', 'P', 'J' };
+    const std::uint32_t VERSION = 1;
+    const std::uint32_t MAX_RECORD_BYTES = 64u << 20; // Anything larger is corruption
+
+    void appendU32(std::string& buffer, std::uint32_t value) {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void appendI32(std::string& buffer, std::int32_t value) {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void appendString(std::string& buffer, const std::string& value) {
+        appendU32(buffer, static_cast<std::uint32_t>(value.size()));
+        buffer.append(value);
+    }
+
+    // Bounds-checked readers; return false once the input runs out.
+    bool readU32(const char*& cursor, const char* end, std::uint32_t& value) {
+        if (end - cursor < static_cast<std::ptrdiff_t>(sizeof(value))) return false;
+        std::memcpy(&value, cursor, sizeof(value));
+        cursor += sizeof(value);
+        return true;
+    }
+
+    bool readI32(const char*& cursor, const char* end, std::int32_t& value) {
+        if (end - cursor < static_cast<std::ptrdiff_t>(sizeof(value))) return false;
+        std::memcpy(&value, cursor, sizeof(value));
+        cursor += sizeof(value);
+        return true;
+    }
+
+    bool readString(const char*& cursor, const char* end, std::string& value) {
+        std::uint32_t length;
+        if (!readU32(cursor, end, length) || static_cast<std::uint32_t>(end - cursor) < length) return false;
+        value.assign(cursor, length);
+        cursor += length;
+        return true;
+    }
+
+    // CRC-32 of a whole file; an absent file counts as empty.
+    std::uint32_t fileChecksum(const std::string& filename, std::size_t& size) {
+        MappedFile file;
+        if (!file.open(filename)) {
+            size = 0;
+            return crc32(nullptr, 0);
+        }
+        size = file.size();
+        return crc32(file.data(), file.size());
+    }
+
+    bool fileExists(const std::string& filename) {
+        std::FILE* file = std::fopen(filename.c_str(), "rb");
+        if (file) std::fclose(file);
+        return file != nullptr;
+    }
+}
+
+// --- Constructor/Destructor ---
+RecipeJournal::RecipeJournal(const std::string& snapshotFile, unsigned syncIntervalMs)
+    : snapshotFile(snapshotFile), journalFile(snapshotFile + ".journal"),
+      rotatedFile(snapshotFile + ".journal.old"), syncIntervalMs(syncIntervalMs),
+      recipes(nullptr), store(nullptr), bytesWritten(0), recordCount(0), snapshotBytes(0),
+      file(nullptr), stopping(false) {}
+
+RecipeJournal::~RecipeJournal() {
+    if (store) {
+        store->removeListener(this);
+        store->removeListener(&lineCache);
+    }
+    if (flusher.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            stopping = true;
+        }
+        flushWake.notify_all();
+        flusher.join();
+    }
+    waitForCompaction();
+    std::lock_guard<std::mutex> lock(fileMutex);
+    if (file) {
+        writePending();
+        std::fclose(file);
+    }
+}
+
+// --- Recovery ---
+int RecipeJournal::open(LinkedList<Recipe*>& recipes, RecipeStore& store) {
+    if (this->store) {
+        throw std::logic_error("Journal is already open: " + journalFile);
+    }
+    this->recipes = &recipes;
+    this->store = &store;
+
+    std::uint32_t snapshotChecksum = fileChecksum(snapshotFile, snapshotBytes);
+
+    // Journal ids of the snapshot's recipes, in list (= load) order
+    std::unordered_map<RecipeId, RecipeId> idMap;
+    bool clean = true;
+    int replayed = 0;
+
+    // List positions for O(1) removals during replay, only while replaying
+    RecipeHandles handles(recipes);
+    store.addListener(&handles);
+    try {
+        // A leftover rotated journal means a compaction was interrupted. If its base
+        // is still the current snapshot, the new snapshot never landed: replay it
+        // and then the newer journal on top. Otherwise it is already folded in.
+        bool continuation = false;
+        if (fileExists(rotatedFile)) {
+            int count = replay(rotatedFile, false, snapshotChecksum, idMap, handles, clean);
+            if (count < 0) {
+                std::remove(rotatedFile.c_str());
+            } else {
+                replayed += count;
+                continuation = true;
+                clean = false; // Needs a fresh rotation
+            }
+        }
+
+        if (fileExists(journalFile)) {
+            int count = replay(journalFile, continuation, snapshotChecksum, idMap, handles, clean);
+            if (count < 0) {
+                std::string rejected = journalFile + ".rejected";
+                std::cerr << "Warning: " << journalFile << " does not match " << snapshotFile
+                          << "; moved to " << rejected << "\n";
+                std::rename(journalFile.c_str(), rejected.c_str());
+                clean = false;
+            } else {
+                replayed += count;
+            }
+        } else {
+            clean = false;
+        }
+    } catch (...) {
+        store.removeListener(&handles);
+        throw;
+    }
+    store.removeListener(&handles);
+
+    // Logging can continue in the existing journal only if this session's ids
+    // are exactly the ones it was written with.
+    for (std::unordered_map<RecipeId, RecipeId>::const_iterator it = idMap.begin(); clean && it != idMap.end(); ++it) {
+        clean = it->first == it->second;
+    }
+
+    store.addListener(this, false);
+    store.addListener(&lineCache, false);
+    if (clean) {
+        std::lock_guard<std::mutex> lock(fileMutex);
+        file = std::fopen(journalFile.c_str(), "ab");
+        if (!file) {
+            throw std::runtime_error("Could not open journal " + journalFile);
+        }
+        bytesWritten = static_cast<std::size_t>(std::ftell(file));
+        recordCount = static_cast<std::size_t>(replayed);
+    } else if (replayed == 0 && !fileExists(rotatedFile)) {
+        // Nothing to fold in: start a journal over the snapshot as it is
+        std::lock_guard<std::mutex> lock(fileMutex);
+        createJournal(currentHeader(snapshotChecksum));
+    } else {
+        compact();
+    }
+
+    flusher = std::thread(&RecipeJournal::flusherLoop, this);
+    return replayed;
+}
+
+bool RecipeJournal::readHeader(const char*& cursor, const char* end, JournalHeader& header) const {
+    const char* start = cursor;
+    std::uint32_t version, baseCount, checksum;
+    if (end - cursor < 4 || std::memcmp(cursor, MAGIC, 4) != 0) return false;
+    cursor += 4;
+    if (!readU32(cursor, end, version) || version != VERSION) return false;
+    if (!readU32(cursor, end, header.snapshotChecksum) || !readU32(cursor, end, baseCount)) return false;
+    if (static_cast<std::size_t>(end - cursor) / sizeof(std::int32_t) < baseCount) return false;
+    header.baseIds.resize(baseCount);
+    for (std::uint32_t i = 0; i < baseCount; ++i) {
+        readI32(cursor, end, header.baseIds[i]);
+    }
+    std::uint32_t expected = crc32(start, static_cast<std::size_t>(cursor - start));
+    return readU32(cursor, end, checksum) && checksum == expected;
+}
+
+// Replays one journal file. Returns the number of records applied, or -1 if the
+// file belongs to a different snapshot or its base ids do not line up with
+// the loaded recipes. idMap is rebuilt from the header's base
+// ids. A continuation (journal started by an interrupted compaction) was
+// written with the ids that replaying the rotated journal just reproduced, so
+// its ids map to themselves. 'clean' is cleared on a torn tail or on records
+// that could not be applied.
+int RecipeJournal::replay(const std::string& path, bool continuation, std::uint32_t snapshotChecksum,
+                          std::unordered_map<RecipeId, RecipeId>& idMap, RecipeHandles& handles, bool& clean) {
+    MappedFile mapped;
+    if (!mapped.open(path)) {
+        clean = false;
+        return 0;
+    }
+    const char* cursor = mapped.data();
+    const char* end = cursor + mapped.size();
+
+    JournalHeader header;
+    if (!readHeader(cursor, end, header)) {
+        std::cerr << "Warning: " << path << " has a damaged header and was ignored\n";
+        clean = false;
+        return 0;
+    }
+    idMap.clear();
+    if (continuation) {
+        for (std::size_t i = 0; i < header.baseIds.size(); ++i) {
+            idMap[header.baseIds[i]] = header.baseIds[i];
+        }
+    } else {
+        if (header.snapshotChecksum != snapshotChecksum) {
+            return -1;
+        }
+        // Snapshot recipes were added to the store in list order. Base ids are
+        // matched by position, so if the load came up with a different number
+        // of recipes (a line that no longer parses) every later record would
+        // land on the wrong recipe: refuse the whole journal instead.
+        if (static_cast<std::size_t>(recipes->size()) != header.baseIds.size()) {
+            std::cerr << "Warning: " << path << " was written over " << header.baseIds.size()
+                      << " recipes but " << recipes->size() << " were loaded\n";
+            return -1;
+        }
+        std::size_t index = 0;
+        for (LinkedList<Recipe*>::iterator it = recipes->begin(); it != recipes->end(); ++it, ++index) {
+            idMap[header.baseIds[index]] = (*it)->getId();
+        }
+    }
+
+    int applied = 0;
+    while (cursor != end) {
+        const char* recordStart = cursor;
+        std::uint32_t length, checksum;
+        if (!readU32(cursor, end, length) || !readU32(cursor, end, checksum) ||
+            length > MAX_RECORD_BYTES || static_cast<std::uint32_t>(end - cursor) < length + 1 ||
+            crc32(cursor, length + 1) != checksum) {
+            std::cerr << "Warning: " << path << " ends with a torn record at byte "
+                      << (recordStart - mapped.data()) << "; it was dropped\n";
+            clean = false;
+            break;
+        }
+        Op op = static_cast<Op>(static_cast<std::uint8_t>(*cursor));
+        if (applyRecord(op, cursor + 1, cursor + 1 + length, idMap, handles)) {
+            applied++;
+        } else {
+            clean = false;
+        }
+        cursor += length + 1;
+    }
+    return applied;
+}
+
+// Applies one record to the recipes and store. Returns false if it was skipped.
+bool RecipeJournal::applyRecord(Op op, const char* cursor, const char* end,
+                                std::unordered_map<RecipeId, RecipeId>& idMap, RecipeHandles& handles) {
+    std::int32_t journalId;
+    if (!readI32(cursor, end, journalId)) return false;
+
+    if (op == Op::AddRecipe) {
+        std::string line;
+        if (!readString(cursor, end, line)) return false;
+        Recipe* recipe = nullptr;
+        try {
+            recipe = Recipe::deserialize(line);
+        } catch (const std::exception& e) {
+            // e.g. written before titles were checked for '|'; later records
+            // naming this recipe are skipped as unknown
+            std::cerr << "Warning: journal record adding recipe " << journalId
+                      << " could not be parsed and was skipped: " << e.what() << "\n";
+            return false;
+        }
+        if (!recipe) return false;
+        recipes->push_back(recipe);
+        idMap[journalId] = store->add(recipe);
+        return true;
+    }
+
+    std::unordered_map<RecipeId, RecipeId>::iterator mapped = idMap.find(journalId);
+    Recipe* recipe = mapped == idMap.end() ? nullptr : store->get(mapped->second);
+    if (!recipe) return false;
+
+    try {
+        std::string text, name, quantity;
+        std::int32_t value;
+        switch (op) {
+        case Op::RemoveRecipe:
+            handles.erase(*recipe); // O(1) through its list position
+            idMap.erase(mapped);
+            delete recipe; // Leaves the store through the destructor hook
+            return true;
+        case Op::SetTitle:
+            if (!readString(cursor, end, text)) return false;
+            recipe->setTitle(text);
+            return true;
+        case Op::SetPrepTime:
+            if (!readI32(cursor, end, value)) return false;
+            recipe->setPrepTime(value);
+            return true;
+        case Op::SetMealType:
+            if (!readI32(cursor, end, value)) return false;
+            recipe->setMealType(static_cast<MealType>(value));
+            return true;
+        case Op::SetDietType:
+            if (!readI32(cursor, end, value)) return false;
+            recipe->setDietType(static_cast<DietType>(value));
+            return true;
+        case Op::AddIngredient:
+            if (!readString(cursor, end, name) || !readString(cursor, end, quantity)) return false;
+            recipe->addIngredient(Ingredient(name, quantity));
+            return true;
+        case Op::RemoveIngredient:
+            if (!readString(cursor, end, name)) return false;
+            recipe->removeIngredient(name);
+            return true;
+        case Op::EditIngredient:
+            if (!readString(cursor, end, text) || !readString(cursor, end, name) || !readString(cursor, end, quantity)) return false;
+            recipe->editIngredient(text, Ingredient(name, quantity));
+            return true;
+        default:
+            return false;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Warning: journal record could not be applied: " << e.what() << "\n";
+        return false;
+    }
+}
+
+// --- Appending ---
+void RecipeJournal::appendRecord(Op op, const std::string& payload) {
+    std::string record;
+    record.reserve(payload.size() + 9);
+    appendU32(record, static_cast<std::uint32_t>(payload.size()));
+    std::uint8_t opByte = static_cast<std::uint8_t>(op);
+    std::uint32_t checksum = crc32(payload.data(), payload.size(), crc32(&opByte, 1));
+    appendU32(record, checksum);
+    record.push_back(static_cast<char>(opByte));
+    record.append(payload);
+
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    pending.append(record);
+    bytesWritten += record.size();
+    recordCount++;
+}
+
+void RecipeJournal::writePending() {
+    std::string batch;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        batch.swap(pending);
+    }
+    if (batch.empty() || !file) {
+        return;
+    }
+    if (std::fwrite(batch.data(), 1, batch.size(), file) != batch.size() || !syncFile(file)) {
+        std::cerr << "Warning: could not write journal " << journalFile << "\n";
+    }
+}
+
+void RecipeJournal::sync() {
+    std::lock_guard<std::mutex> lock(fileMutex);
+    writePending();
+}
+
+// Group commit: one write + fsync per interval covers every record since the last one.
+void RecipeJournal::flusherLoop() {
+    std::unique_lock<std::mutex> lock(pendingMutex);
+    while (!stopping) {
+        flushWake.wait_for(lock, std::chrono::milliseconds(syncIntervalMs));
+        if (pending.empty()) {
+            continue;
+        }
+        lock.unlock();
+        sync();
+        lock.lock();
+    }
+}
+
+std::size_t RecipeJournal::journalBytes() const {
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    return bytesWritten;
+}
+
+std::size_t RecipeJournal::journalRecords() const {
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    return recordCount;
+}
+
+// --- Compaction ---
+bool RecipeJournal::needsCompaction() const {
+    std::size_t bytes = journalBytes();
+    return bytes >= COMPACT_MIN_BYTES && bytes >= snapshotBytes / 2;
+}
+
+RecipeJournal::JournalHeader RecipeJournal::currentHeader(std::uint32_t snapshotChecksum) const {
+    JournalHeader header;
+    header.snapshotChecksum = snapshotChecksum;
+    const LinkedList<Recipe*>& list = *recipes;
+    for (LinkedList<Recipe*>::const_iterator it = list.begin(); it != list.end(); ++it) {
+        header.baseIds.push_back((*it)->getId());
+    }
+    return header;
+}
+
+void RecipeJournal::createJournal(const JournalHeader& header) {
+    std::string bytes(MAGIC, sizeof(MAGIC));
+    appendU32(bytes, VERSION);
+    appendU32(bytes, header.snapshotChecksum);
+    appendU32(bytes, static_cast<std::uint32_t>(header.baseIds.size()));
+    for (std::size_t i = 0; i < header.baseIds.size(); ++i) {
+        appendI32(bytes, header.baseIds[i]);
+    }
+    appendU32(bytes, crc32(bytes.data(), bytes.size()));
+
+    file = std::fopen(journalFile.c_str(), "wb");
+    if (!file || std::fwrite(bytes.data(), 1, bytes.size(), file) != bytes.size() || !syncFile(file)) {
+        throw std::runtime_error("Could not create journal " + journalFile);
+    }
+    syncParentDirectory(journalFile);
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    bytesWritten = bytes.size();
+    recordCount = 0;
+}
+
+// The snapshot view is captured here, on the caller's thread, so it reflects
+// exactly the records before the rotation. Only the write + fsync runs in the
+// background; until it lands, recovery replays the rotated journal.
+void RecipeJournal::compact() {
+    if (!store) {
+        throw std::logic_error("Journal is not open: " + journalFile);
+    }
+    waitForCompaction();
+
+    SnapshotView view = lineCache.capture(*recipes);
+    std::uint32_t checksum = view.checksum();
+    std::lock_guard<std::mutex> lock(fileMutex);
+    if (file) {
+        writePending();
+        std::fclose(file);
+        file = nullptr;
+    }
+    snapshotBytes = view.bytes;
+    if (fileExists(rotatedFile)) {
+        // Recovery left both journals unfolded: only one can be rotated,
+        // so land the snapshot before the live journal is replaced.
+        SnapshotWriter::write(snapshotFile, view);
+        std::remove(rotatedFile.c_str());
+        createJournal(currentHeader(checksum));
+        return;
+    }
+    if (fileExists(journalFile)) {
+        std::rename(journalFile.c_str(), rotatedFile.c_str());
+    }
+    createJournal(currentHeader(checksum));
+
+    std::string rotated = rotatedFile;
+    writer.writeAsync(snapshotFile, view, [rotated]() { std::remove(rotated.c_str()); });
+}
+
+void RecipeJournal::waitForCompaction() {
+    try {
+        writer.wait();
+    } catch (const std::exception& e) {
+        // The rotated journal stays behind and is replayed on the next start
+        std::cerr << "Warning: compaction failed: " << e.what() << "\n";
+    }
+}
+
+// --- RecipeListener Hooks ---
+void RecipeJournal::onRecipeAdded(const Recipe& recipe) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendString(payload, recipe.serialize());
+    appendRecord(Op::AddRecipe, payload);
+}
+
+void RecipeJournal::onRecipeRemoved(const Recipe& recipe) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendRecord(Op::RemoveRecipe, payload);
+}
+
+void RecipeJournal::onTitleChanged(const Recipe& recipe, const std::string&) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendString(payload, recipe.getTitle());
+    appendRecord(Op::SetTitle, payload);
+}
+
+void RecipeJournal::onPrepTimeChanged(const Recipe& recipe, int) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendI32(payload, recipe.getPrepTime());
+    appendRecord(Op::SetPrepTime, payload);
+}
+
+void RecipeJournal::onMealTypeChanged(const Recipe& recipe, MealType) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendI32(payload, static_cast<std::int32_t>(recipe.getMealType()));
+    appendRecord(Op::SetMealType, payload);
+}
+
+void RecipeJournal::onDietTypeChanged(const Recipe& recipe, DietType) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendI32(payload, static_cast<std::int32_t>(recipe.getDietType()));
+    appendRecord(Op::SetDietType, payload);
+}
+
+void RecipeJournal::onIngredientAdded(const Recipe& recipe, const Ingredient& ingredient) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendString(payload, ingredient.getName());
+    appendString(payload, ingredient.getQuantity());
+    appendRecord(Op::AddIngredient, payload);
+}
+
+void RecipeJournal::onIngredientRemoved(const Recipe& recipe, const Ingredient& ingredient) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendString(payload, ingredient.getName());
+    appendRecord(Op::RemoveIngredient, payload);
+}
+
+void RecipeJournal::onIngredientEdited(const Recipe& recipe, const Ingredient& oldIngredient, const Ingredient& newIngredient) {
+    std::string payload;
+    appendI32(payload, recipe.getId());
+    appendString(payload, oldIngredient.getName());
+    appendString(payload, newIngredient.getName());
+    appendString(payload, newIngredient.getQuantity());
+    appendRecord(Op::EditIngredient, payload);
+}
@@ -0,0 +1,134 @@
+// src/RecipeJournal.h
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "RecipeListener.h"
+#include "RecipeStore.h"
+#include "LinkedList.h"
+#include "RecipeHandles.h"
+#include "SnapshotWriter.h"
+
+// =============================
+// Write-Ahead Recipe Journal
+// - Every add/edit/remove/ingredient change reported by the RecipeStore is
+//   appended as a small checksummed record to "<snapshot>.journal"
+// - Records are buffered and written + fsynced in batches by a background
+//   flusher (group commit), so logging a change costs microseconds
+// - On startup the journal is replayed over the last snapshot; a torn tail
+//   (crash mid-append) is detected by its checksum and dropped
+// - Compaction rotates the journal and writes a fresh snapshot with the
+//   SnapshotWriter in the background; the old journal is deleted once the snapshot is safe
+//
+// Journal ids: records name recipes by the store id of the session that
+// wrote them. Each journal header lists the base snapshot's CRC-32 and the
+// writing session's ids in snapshot order, which lets replay map them onto
+// the ids assigned when the snapshot is loaded again. A journal whose base
+// count differs from the recipes loaded is set aside as ".rejected" rather
+// than replayed onto the wrong recipes.
+// =============================
+
+class RecipeJournal : public RecipeListener {
+public:
+    static const std::size_t COMPACT_MIN_BYTES = 1 << 20; // Never compact smaller journals
+
+    explicit RecipeJournal(const std::string& snapshotFile, unsigned syncIntervalMs = 50);
+    ~RecipeJournal(); // Syncs, finishes any compaction and stops the flusher
+
+    // Replays pending journal records onto the freshly loaded snapshot
+    // (recipes + store, ids assigned in list order), then starts logging as
+    // a listener of 'store'. Returns the number of records replayed.
+    int open(LinkedList<Recipe*>& recipes, RecipeStore& store);
+
+    // Writes and fsyncs every buffered record now.
+    void sync();
+
+    // True once the journal outgrows COMPACT_MIN_BYTES and half the snapshot.
+    bool needsCompaction() const;
+
+    // Rotates the journal and writes a new snapshot in the background.
+    // Must be called between operations (never from inside a listener hook).
+    void compact();
+    void waitForCompaction();
+
+    std::size_t journalBytes() const;
+    std::size_t journalRecords() const; // Changes not yet folded into the snapshot
+    const std::string& getJournalFile() const { return journalFile; }
+
+    // RecipeListener hooks (append one record each)
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onTitleChanged(const Recipe& recipe, const std::string& oldTitle) override;
+    void onPrepTimeChanged(const Recipe& recipe, int oldPrepTime) override;
+    void onMealTypeChanged(const Recipe& recipe, MealType oldMealType) override;
+    void onDietTypeChanged(const Recipe& recipe, DietType oldDietType) override;
+    void onIngredientAdded(const Recipe& recipe, const Ingredient& ingredient) override;
+    void onIngredientRemoved(const Recipe& recipe, const Ingredient& ingredient) override;
+    void onIngredientEdited(const Recipe& recipe, const Ingredient& oldIngredient, const Ingredient& newIngredient) override;
+
+private:
+    enum class Op : std::uint8_t {
+        AddRecipe = 1,
+        RemoveRecipe,
+        SetTitle,
+        SetPrepTime,
+        SetMealType,
+        SetDietType,
+        AddIngredient,
+        RemoveIngredient,
+        EditIngredient
+    };
+
+    // Base snapshot a journal file applies to
+    struct JournalHeader {
+        std::uint32_t snapshotChecksum;
+        std::vector<RecipeId> baseIds; // Writing session's ids, in snapshot order
+    };
+
+    std::string snapshotFile;
+    std::string journalFile;
+    std::string rotatedFile;     // Journal being folded into a snapshot
+    unsigned syncIntervalMs;
+
+    LinkedList<Recipe*>* recipes; // Set by open()
+    RecipeStore* store;
+
+    // Append path: hooks fill 'pending'; the flusher or sync() writes it out
+    mutable std::mutex pendingMutex;
+    std::string pending;
+    std::size_t bytesWritten;    // Journal file size including pending bytes
+    std::size_t recordCount;     // Records in the live journal, including pending ones
+    std::size_t snapshotBytes;
+
+    std::mutex fileMutex;        // Serializes writes, fsyncs and rotation
+    std::FILE* file;
+
+    std::thread flusher;
+    std::condition_variable flushWake;
+    bool stopping;
+
+    SnapshotCache lineCache;     // Serialized lines for compaction snapshots
+    SnapshotWriter writer;       // Background snapshot writes
+
+    void appendRecord(Op op, const std::string& payload);
+    void writePending();         // Caller holds fileMutex
+    void flusherLoop();
+    void createJournal(const JournalHeader& header); // Caller holds fileMutex
+    JournalHeader currentHeader(std::uint32_t snapshotChecksum) const;
+
+    bool readHeader(const char*& cursor, const char* end, JournalHeader& header) const;
+    int replay(const std::string& path, bool continuation, std::uint32_t snapshotChecksum,
+               std::unordered_map<RecipeId, RecipeId>& idMap, RecipeHandles& handles, bool& clean);
+    bool applyRecord(Op op, const char* cursor, const char* end,
+                     std::unordered_map<RecipeId, RecipeId>& idMap, RecipeHandles& handles);
+
+    // Not copyable: owns files and threads
+    RecipeJournal(const RecipeJournal&);
+    RecipeJournal& operator=(const RecipeJournal&);
+};
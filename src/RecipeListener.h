@@ -0,0 +1,35 @@
+// src/RecipeListener.h
+#pragma once
+
+#include <string>
+#include "MealType.h"
+#include "DietType.h"
+#include "Ingredient.h"
+
+class Recipe;
+
+// Observer interface for components that mirror recipe state (the columnar
+// RecipeStore and the indexes built on top of it). A Recipe notifies its
+// listener after each change; every hook defaults to a no-op.
+class RecipeListener {
+public:
+    virtual ~RecipeListener() = default;
+
+    // Catalog membership
+    virtual void onRecipeAdded(const Recipe&) {}
+    virtual void onRecipeRemoved(const Recipe&) {}
+
+    // Field changes (the recipe already holds the new value)
+    virtual void onTitleChanged(const Recipe&, const std::string&) {}
+    virtual void onPrepTimeChanged(const Recipe&, int) {}
+    virtual void onMealTypeChanged(const Recipe&, MealType) {}
+    virtual void onDietTypeChanged(const Recipe&, DietType) {}
+
+    // Ingredient changes. An edit is reported as remove + add unless overridden.
+    virtual void onIngredientAdded(const Recipe&, const Ingredient&) {}
+    virtual void onIngredientRemoved(const Recipe&, const Ingredient&) {}
+    virtual void onIngredientEdited(const Recipe& recipe, const Ingredient& oldIngredient, const Ingredient& newIngredient) {
+        onIngredientRemoved(recipe, oldIngredient);
+        onIngredientAdded(recipe, newIngredient);
+    }
+};
@@ -2,12 +2,15 @@
 #include "VeganRecipe.h"
 #include "VegetarianRecipe.h"
 #include "OmnivoreRecipe.h"
+#include "BinaryCatalog.h"
+#include "RecipeParser.h"
+#include "SnapshotWriter.h"
 #include <sstream>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 #include <algorithm>
 #include <cctype>
-#include <fstream>
 
 Recipe* RecipeManager::addRecipe() {
     std::string input;
@@ -38,6 +41,10 @@ Recipe* RecipeManager::addRecipe() {
             std::cout << "Error: Title cannot be empty.\n";
             continue;
         }
+        if (!Recipe::isValidTitle(title)) {
+            std::cout << "Error: Title cannot contain '|'.\n";
+            continue;
+        }
         
         try {
             prepTime = std::stoi(prepTimeStr);
@@ -135,17 +142,18 @@ Recipe* RecipeManager::addRecipe() {
                 break;
             }
             
-            bool duplicate = false;
-            for (const auto& ing : recipe->getIngredients()) {
-                if (ing.getName() == name) {
-                    std::cout << "Warning: Duplicate ingredient '" << name << "' skipped.\n";
-                    duplicate = true;
+            bool duplicate = recipe->matchesIngredient(name);
+            if (duplicate) {
+                std::cout << "Warning: Duplicate ingredient '" << name << "' skipped.\n";
+            } else {
+                try {
+                    recipe->addIngredient(Ingredient(name, quantity));
+                } catch (const std::invalid_argument& e) {
+                    std::cout << "Error: " << e.what() << "\n";
+                    validInput = false;
                     break;
                 }
             }
-            if (!duplicate) {
-                recipe->addIngredient(Ingredient(name, quantity));
-            }
         }
         
         if (validInput) break;
@@ -155,40 +163,81 @@ Recipe* RecipeManager::addRecipe() {
 }
 
 // UML-compliant static factory
-Recipe* RecipeManager::addRecipe(const std::string& title, int prepTime, MealType mealType, DietType dietType) {
+Recipe* RecipeManager::addRecipe(std::string title, int prepTime, MealType mealType, DietType dietType) {
     switch (dietType) {
         case DietType::Vegan:
-            return new VeganRecipe(title, prepTime, mealType);
+            return new VeganRecipe(std::move(title), prepTime, mealType);
         case DietType::Vegetarian:
-            return new VegetarianRecipe(title, prepTime, mealType);
+            return new VegetarianRecipe(std::move(title), prepTime, mealType);
         case DietType::Omnivore:
-            return new OmnivoreRecipe(title, prepTime, mealType);
+            return new OmnivoreRecipe(std::move(title), prepTime, mealType);
         default:
             throw std::invalid_argument("Invalid or unhandled diet type");
     }
 }
 
-LinkedList<Recipe*> RecipeManager::loadFromFile(const std::string& filename) {
+LinkedList<Recipe*> RecipeManager::loadFromFile(const std::string& filename, unsigned threads) {
     LinkedList<Recipe*> recipes;
-    std::ifstream inFile(filename);
-    if (!inFile) return recipes;
-    std::string line;
-    while (std::getline(inFile, line)) {
-        if (line.empty()) continue;
+    std::vector<ParseError> errors;
+    if (threads == 1) {
+        RecipeParser::parseFile(filename, recipes, errors);
+    } else {
+        RecipeParser::parseFileParallel(filename, recipes, errors, threads);
+    }
+    for (std::vector<ParseError>::const_iterator it = errors.begin(); it != errors.end(); ++it) {
+        std::cerr << "Error loading recipe (line " << it->line() << "): " << it->what() << std::endl;
+    }
+    return recipes; // Moved out (O(1)) when not elided
+}
+
+void RecipeManager::saveToFile(const std::string& filename, const LinkedList<Recipe*>& recipes) {
+    SnapshotWriter::write(filename, recipes);
+}
+
+// Materializes every record of a binary catalog. Throws std::runtime_error on a corrupt file.
+LinkedList<Recipe*> RecipeManager::loadFromBinaryFile(const std::string& filename) {
+    BinaryCatalog catalog;
+    catalog.open(filename);
+    LinkedList<Recipe*> recipes;
+    for (std::size_t i = 0; i < catalog.size(); ++i) {
         try {
-            Recipe* recipe = Recipe::deserialize(line);
-            if (recipe) recipes.push_back(recipe);
-        } catch (const std::exception& e) {
+            recipes.push_back(catalog.materialize(i));
+        } catch (const std::invalid_argument& e) {
             std::cerr << "Error loading recipe: " << e.what() << std::endl;
         }
     }
     return recipes;
 }
 
-void RecipeManager::saveToFile(const std::string& filename, const LinkedList<Recipe*>& recipes) {
-    std::ofstream outFile(filename);
-    if (!outFile) return;
-    for (const auto& recipePtr : recipes) {
-        if (recipePtr) outFile << recipePtr->serialize() << std::endl;
+void RecipeManager::saveToBinaryFile(const std::string& filename, const LinkedList<Recipe*>& recipes) {
+    BinaryCatalog::write(filename, recipes);
+}
+
+int RecipeManager::convertTextToBinary(const std::string& textFile, const std::string& binaryFile) {
+    LinkedList<Recipe*> recipes = loadFromFile(textFile);
+    saveToBinaryFile(binaryFile, recipes);
+    return recipes.size();
+}
+
+int RecipeManager::convertBinaryToText(const std::string& binaryFile, const std::string& textFile) {
+    LinkedList<Recipe*> recipes = loadFromBinaryFile(binaryFile);
+    saveToFile(textFile, recipes);
+    return recipes.size();
+}
+
+// Counts every ingredient name in the list. The pool is shared by the whole
+// process, so its full size is charged against these recipes.
+InternStats RecipeManager::internStats(const LinkedList<Recipe*>& recipes) {
+    InternStats stats;
+    for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
+        if (!*it) continue;
+        const IngredientList& ingredients = (*it)->getIngredients();
+        for (IngredientList::const_iterator ing = ingredients.begin(); ing != ingredients.end(); ++ing) {
+            stats.references++;
+            stats.stringBytes += stringFootprint(ing->getName().size());
+        }
     }
+    stats.internedBytes = stats.references * (sizeof(IngredientId) + sizeof(std::uint32_t)) +
+                          IngredientPool::instance().poolBytes();
+    return stats;
 }
@@ -8,8 +8,18 @@ public:
     // Interactive version
     static Recipe* addRecipe();
     // UML-compliant static factory
-    static Recipe* addRecipe(const std::string& title, int prepTime, MealType mealType, DietType dietType);
+    static Recipe* addRecipe(std::string title, int prepTime, MealType mealType, DietType dietType);
     // Static file I/O methods
-    static LinkedList<Recipe*> loadFromFile(const std::string& filename);
+    // threads: 1 = sequential streaming parse, 0 = one thread per core, n = n threads
+    static LinkedList<Recipe*> loadFromFile(const std::string& filename, unsigned threads = 1);
+    // Atomic snapshot write (see SnapshotWriter.h); throws std::runtime_error on failure
     static void saveToFile(const std::string& filename, const LinkedList<Recipe*>& recipes);
+    // Binary catalog I/O (see BinaryCatalog.h)
+    static LinkedList<Recipe*> loadFromBinaryFile(const std::string& filename);
+    static void saveToBinaryFile(const std::string& filename, const LinkedList<Recipe*>& recipes);
+    // Format converters; return the number of recipes converted
+    static int convertTextToBinary(const std::string& textFile, const std::string& binaryFile);
+    static int convertBinaryToText(const std::string& binaryFile, const std::string& textFile);
+    // Ingredient name memory with the intern pool versus one string per name
+    static InternStats internStats(const LinkedList<Recipe*>& recipes);
 };
@@ -0,0 +1,342 @@
+// src/RecipeParser.cpp
+// Allocation-light parser for the pipe-delimited recipe catalog.
+#include "RecipeParser.h"
+#include "RecipeManager.h"
+#include "MappedFile.h"
+#include "ThreadPool.h"
+#include <cstdio>  // For std::fopen, std::fread
+#include <cstring> // For std::memchr, std::memmove
+#include <algorithm> // For std::max
+
+// --- TextSpan / ParseError ---
+bool TextSpan::equals(const char* literal) const {
+    std::size_t length = std::strlen(literal);
+    return length == size() && std::memcmp(begin, literal, length) == 0;
+}
+
+static std::string formatParseError(const std::string& message, int column) {
+    return message + " (column " + std::to_string(column) + ")";
+}
+
+ParseError::ParseError(const std::string& message, int line, int column)
+    : std::runtime_error(formatParseError(message, column)), lineNumber(line), columnNumber(column) {}
+
+// --- Tokenizing ---
+namespace {
+    // Cuts the next token off 'cursor' up to 'delimiter' (or 'end').
+    // Sets 'found' when the delimiter was present and skips past it.
+    TextSpan nextToken(const char*& cursor, const char* end, char delimiter, bool& found) {
+        const char* start = cursor;
+        const char* stop = static_cast<const char*>(std::memchr(start, delimiter, end - start));
+        found = stop != nullptr;
+        if (!found) {
+            stop = end;
+        }
+        cursor = found ? stop + 1 : end;
+        return TextSpan(start, stop);
+    }
+
+    // Same rules as 'stream >> int': surrounding blanks allowed, optional sign.
+    bool parseInt(TextSpan token, int& value) {
+        const char* p = token.begin;
+        while (p != token.end && (*p == ' ' || *p == '\t')) ++p;
+        bool negative = false;
+        if (p != token.end && (*p == '-' || *p == '+')) {
+            negative = (*p == '-');
+            ++p;
+        }
+        if (p == token.end || *p < '0' || *p > '9') {
+            return false;
+        }
+        long long result = 0;
+        while (p != token.end && *p >= '0' && *p <= '9') {
+            result = result * 10 + (*p - '0');
+            if (result > 2147483647LL) return false;
+            ++p;
+        }
+        while (p != token.end && (*p == ' ' || *p == '\t')) ++p;
+        if (p != token.end) {
+            return false;
+        }
+        value = static_cast<int>(negative ? -result : result);
+        return true;
+    }
+
+    int columnOf(const char* lineBegin, const char* position) {
+        return static_cast<int>(position - lineBegin) + 1;
+    }
+
+    // FNV-1a over the token bytes
+    std::uint64_t hashSpan(TextSpan text) {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const char* p = text.begin; p != text.end; ++p) {
+            hash = (hash ^ static_cast<unsigned char>(*p)) * 1099511628211ULL;
+        }
+        return hash;
+    }
+}
+
+// --- ParseCache ---
+ParseCache::ParseCache() : count(0) {}
+
+void ParseCache::grow() {
+    std::vector<Entry> old;
+    old.swap(slots);
+    slots.resize(old.empty() ? 256 : old.size() * 2);
+    std::size_t mask = slots.size() - 1;
+    for (std::size_t i = 0; i < old.size(); ++i) {
+        if (!old[i].used) continue;
+        std::size_t j = static_cast<std::size_t>(old[i].hash) & mask;
+        while (slots[j].used) j = (j + 1) & mask;
+        slots[j] = std::move(old[i]);
+    }
+}
+
+Ingredient ParseCache::ingredient(TextSpan name, TextSpan quantity) {
+    if (count >= MAX_ENTRIES) {
+        return Ingredient(name.str(), quantity.str());
+    }
+    if ((count + 1) * 2 > slots.size()) {
+        grow();
+    }
+    TextSpan pair(name.begin, quantity.end);
+    std::uint64_t hash = hashSpan(pair);
+    std::size_t mask = slots.size() - 1;
+    std::size_t i = static_cast<std::size_t>(hash) & mask;
+    while (slots[i].used) {
+        const Entry& entry = slots[i];
+        if (entry.hash == hash && entry.key.size() == pair.size() &&
+            std::memcmp(entry.key.data(), pair.begin, pair.size()) == 0) {
+            return entry.value;
+        }
+        i = (i + 1) & mask;
+    }
+    Entry& entry = slots[i];
+    entry.value = Ingredient(name.str(), quantity.str()); // May throw; the slot stays free
+    entry.key = pair.str();
+    entry.hash = hash;
+    entry.used = true;
+    count++;
+    return entry.value;
+}
+
+// --- Line Parsing ---
+Recipe* RecipeParser::parseLine(const char* begin, const char* end, int lineNumber) {
+    ParseCache cache;
+    return parseLine(begin, end, lineNumber, cache);
+}
+
+Recipe* RecipeParser::parseLine(const char* begin, const char* end, int lineNumber, ParseCache& cache) {
+    if (end != begin && end[-1] == '\r') {
+        --end; // Tolerate CRLF files
+    }
+    const char* cursor = begin;
+    bool found = false;
+
+    TextSpan type = nextToken(cursor, end, '|', found);
+    if (!found) {
+        throw ParseError("Missing '|' after recipe type", lineNumber, columnOf(begin, end));
+    }
+    DietType recipeType;
+    if (type.equals("Vegan")) {
+        recipeType = DietType::Vegan;
+    } else if (type.equals("Vegetarian")) {
+        recipeType = DietType::Vegetarian;
+    } else if (type.equals("Omnivore")) {
+        recipeType = DietType::Omnivore;
+    } else {
+        throw ParseError("Unknown recipe type: " + type.str(), lineNumber, columnOf(begin, type.begin));
+    }
+
+    TextSpan title = nextToken(cursor, end, '|', found);
+    if (!found) {
+        throw ParseError("Missing '|' after title", lineNumber, columnOf(begin, end));
+    }
+
+    TextSpan prepField = nextToken(cursor, end, '|', found);
+    int prepTime = 0;
+    if (!parseInt(prepField, prepTime)) {
+        throw ParseError("Invalid prep time: '" + prepField.str() + "'", lineNumber, columnOf(begin, prepField.begin));
+    }
+
+    TextSpan meal = nextToken(cursor, end, '|', found);
+    nextToken(cursor, end, '|', found); // Diet type is implied by the recipe type
+    TextSpan ingredientList(cursor, end);
+
+    Recipe* recipe = RecipeManager::addRecipe(title.str(), prepTime,
+                                              stringToMealType(meal.begin, meal.size()), recipeType);
+
+    // Ingredients: name:quantity pairs separated by ';' (pairs without ':' are skipped)
+    const char* ingredientCursor = ingredientList.begin;
+    while (ingredientCursor != ingredientList.end) {
+        bool more = false;
+        TextSpan pair = nextToken(ingredientCursor, ingredientList.end, ';', more);
+        const char* colon = static_cast<const char*>(std::memchr(pair.begin, ':', pair.size()));
+        if (colon != nullptr) {
+            try {
+                recipe->addIngredient(cache.ingredient(TextSpan(pair.begin, colon), TextSpan(colon + 1, pair.end)));
+            } catch (const std::exception& e) {
+                delete recipe;
+                throw ParseError(e.what(), lineNumber, columnOf(begin, pair.begin));
+            }
+        }
+    }
+    return recipe;
+}
+
+// --- Buffer / File Parsing ---
+namespace {
+    // Parses the complete lines in [data, data + size); the trailing partial
+    // line is only parsed when 'lastBlock' is set. Returns the bytes consumed.
+    // Works for any container with push_back(Recipe*).
+    template <typename Container>
+    std::size_t parseLines(const char* data, std::size_t size, bool lastBlock, int& lineNumber,
+                           ParseCache& cache, Container& recipes, std::vector<ParseError>& errors) {
+        const char* cursor = data;
+        const char* end = data + size;
+        while (cursor != end) {
+            const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+            if (newline == nullptr && !lastBlock) {
+                break; // Partial line: wait for the next block
+            }
+            const char* lineEnd = newline ? newline : end;
+            lineNumber++;
+            if (lineEnd != cursor && !(lineEnd - cursor == 1 && *cursor == '\r')) {
+                try {
+                    recipes.push_back(RecipeParser::parseLine(cursor, lineEnd, lineNumber, cache));
+                } catch (const ParseError& e) {
+                    errors.push_back(e);
+                } catch (const std::exception& e) {
+                    errors.push_back(ParseError(e.what(), lineNumber, 1));
+                }
+            }
+            cursor = newline ? newline + 1 : end;
+        }
+        return static_cast<std::size_t>(cursor - data);
+    }
+
+    int countLines(const char* begin, const char* end) {
+        int lines = 0;
+        while (begin != end) {
+            const char* newline = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+            if (!newline) break;
+            lines++;
+            begin = newline + 1;
+        }
+        return lines;
+    }
+}
+
+void RecipeParser::parseBuffer(const char* data, std::size_t size, int firstLine,
+                               LinkedList<Recipe*>& recipes, std::vector<ParseError>& errors) {
+    int lineNumber = firstLine - 1;
+    ParseCache cache;
+    parseLines(data, size, true, lineNumber, cache, recipes, errors);
+}
+
+void RecipeParser::parseBuffer(const char* data, std::size_t size, int firstLine,
+                               std::vector<Recipe*>& recipes, std::vector<ParseError>& errors) {
+    int lineNumber = firstLine - 1;
+    ParseCache cache;
+    parseLines(data, size, true, lineNumber, cache, recipes, errors);
+}
+
+bool RecipeParser::parseFile(const std::string& filename,
+                             LinkedList<Recipe*>& recipes, std::vector<ParseError>& errors) {
+    std::FILE* file = std::fopen(filename.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+
+    std::vector<char> buffer(BLOCK_SIZE);
+    std::size_t carried = 0; // Bytes of an unfinished line kept from the last block
+    int lineNumber = 0;
+    ParseCache cache; // Shared by every block
+    while (true) {
+        if (carried == buffer.size()) {
+            buffer.resize(buffer.size() * 2); // A single line longer than the block
+        }
+        std::size_t read = std::fread(&buffer[carried], 1, buffer.size() - carried, file);
+        std::size_t filled = carried + read;
+        bool lastBlock = (read == 0);
+        std::size_t consumed = parseLines(&buffer[0], filled, lastBlock, lineNumber, cache, recipes, errors);
+        carried = filled - consumed;
+        if (carried > 0) {
+            std::memmove(&buffer[0], &buffer[consumed], carried);
+        }
+        if (lastBlock) {
+            break;
+        }
+    }
+    std::fclose(file);
+    return true;
+}
+
+// Two passes over the mapping, both on the pool: count the newlines in each
+// chunk (so every chunk knows its first line number), then parse. Results
+// are stitched back together in chunk order.
+bool RecipeParser::parseFileParallel(const std::string& filename,
+                                     LinkedList<Recipe*>& recipes, std::vector<ParseError>& errors,
+                                     unsigned threads) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    const char* data = file.data();
+    const std::size_t size = file.size();
+    if (threads == 0) {
+        threads = ThreadPool::defaultThreadCount();
+    }
+    if (threads == 1 || size < PARALLEL_MIN_BYTES) {
+        parseBuffer(data, size, 1, recipes, errors);
+        return true;
+    }
+
+    // Newline-aligned chunk boundaries; a few chunks per thread evens out the load
+    const std::size_t chunkCount = static_cast<std::size_t>(threads) * 4;
+    std::vector<std::size_t> bounds(chunkCount + 1, size);
+    bounds[0] = 0;
+    for (std::size_t i = 1; i < chunkCount; ++i) {
+        std::size_t position = std::max(size / chunkCount * i, bounds[i - 1]);
+        const char* newline = static_cast<const char*>(std::memchr(data + position, '\n', size - position));
+        bounds[i] = newline ? static_cast<std::size_t>(newline - data) + 1 : size;
+    }
+
+    ThreadPool pool(threads);
+    std::vector<int> lineCounts(chunkCount, 0);
+    for (std::size_t i = 0; i < chunkCount; ++i) {
+        pool.submit([&lineCounts, &bounds, data, i]() {
+            lineCounts[i] = countLines(data + bounds[i], data + bounds[i + 1]);
+        });
+    }
+    pool.wait();
+
+    std::vector<std::vector<Recipe*> > chunkRecipes(chunkCount);
+    std::vector<std::vector<ParseError> > chunkErrors(chunkCount);
+    int firstLine = 1;
+    for (std::size_t i = 0; i < chunkCount; ++i) {
+        pool.submit([&chunkRecipes, &chunkErrors, &bounds, data, i, firstLine]() {
+            parseBuffer(data + bounds[i], bounds[i + 1] - bounds[i], firstLine, chunkRecipes[i], chunkErrors[i]);
+        });
+        firstLine += lineCounts[i];
+    }
+    try {
+        pool.wait();
+    } catch (...) {
+        // e.g. out of memory in one chunk: free what the others produced
+        for (std::size_t i = 0; i < chunkCount; ++i) {
+            for (std::size_t j = 0; j < chunkRecipes[i].size(); ++j) {
+                delete chunkRecipes[i][j];
+            }
+        }
+        throw;
+    }
+
+    for (std::size_t i = 0; i < chunkCount; ++i) {
+        for (std::size_t j = 0; j < chunkRecipes[i].size(); ++j) {
+            recipes.push_back(chunkRecipes[i][j]);
+        }
+        errors.insert(errors.end(), chunkErrors[i].begin(), chunkErrors[i].end());
+    }
+    return true;
+}
@@ -0,0 +1,105 @@
+// src/RecipeParser.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "Recipe.h"
+#include "LinkedList.h"
+
+// Non-owning view of characters inside a parse buffer (C++11 stand-in for
+// std::string_view). Valid only while the underlying buffer is.
+struct TextSpan {
+    const char* begin;
+    const char* end;
+
+    TextSpan(const char* begin = nullptr, const char* end = nullptr) : begin(begin), end(end) {}
+    std::size_t size() const { return static_cast<std::size_t>(end - begin); }
+    bool empty() const { return begin == end; }
+    std::string str() const { return std::string(begin, end); }
+    bool equals(const char* literal) const;
+};
+
+// Error raised for a malformed catalog line, with its 1-based position.
+class ParseError : public std::runtime_error {
+private:
+    int lineNumber;
+    int columnNumber;
+public:
+    ParseError(const std::string& message, int line, int column);
+    int line() const { return lineNumber; }
+    int column() const { return columnNumber; }
+};
+
+// Remembers the Ingredient built for every "name:quantity" pair seen so
+// far, so a repeated pair costs one hash of its bytes instead of two locked
+// IngredientPool lookups, two std::string temporaries and a Quantity::parse.
+// Catalogs repeat a small vocabulary of pairs on every line.
+// Not thread-safe: one cache per parsing thread.
+class ParseCache {
+public:
+    static const std::size_t MAX_ENTRIES = 1 << 16; // Later pairs bypass the cache
+
+    ParseCache();
+
+    // 'name' and 'quantity' are the two sides of one pair (the ':' between them)
+    Ingredient ingredient(TextSpan name, TextSpan quantity);
+
+private:
+    struct Entry {
+        std::string key; // Whole pair text
+        std::uint64_t hash;
+        Ingredient value;
+        bool used;
+
+        Entry() : hash(0), used(false) {}
+    };
+
+    // Open addressing, power-of-two capacity, at most half full
+    std::vector<Entry> slots;
+    std::size_t count;
+
+    void grow();
+};
+
+// =============================
+// Streaming parser for the pipe-delimited recipe format
+//   type|title|prepTime|mealType|dietType|name1:qty1;name2:qty2;...
+// - Reads files in large blocks and finds lines with memchr
+// - Splits on '|', ';' and ':' in place; tokens are TextSpans, so only the
+//   strings that end up inside Recipe/Ingredient objects are allocated
+// - Names and quantity texts are resolved through a ParseCache that lives
+//   for the whole buffer or file
+// - Bad lines are skipped and reported with line and column
+// =============================
+
+class RecipeParser {
+public:
+    static const std::size_t BLOCK_SIZE = 1 << 20;          // Bytes read per fread
+    static const std::size_t PARALLEL_MIN_BYTES = 1 << 20;  // Smaller files parse sequentially
+
+    // Parses one line (without its newline). Throws ParseError.
+    static Recipe* parseLine(const char* begin, const char* end, int lineNumber);
+    static Recipe* parseLine(const char* begin, const char* end, int lineNumber, ParseCache& cache);
+
+    // Parses every line of an in-memory buffer. 'firstLine' is the line number
+    // of the first byte. Recipes are appended in order; errors are collected.
+    static void parseBuffer(const char* data, std::size_t size, int firstLine,
+                            LinkedList<Recipe*>& recipes, std::vector<ParseError>& errors);
+    static void parseBuffer(const char* data, std::size_t size, int firstLine,
+                            std::vector<Recipe*>& recipes, std::vector<ParseError>& errors);
+
+    // Streams a whole file. Returns false if the file could not be opened.
+    static bool parseFile(const std::string& filename,
+                          LinkedList<Recipe*>& recipes, std::vector<ParseError>& errors);
+
+    // Maps the file, splits it into newline-aligned chunks and parses them on
+    // a thread pool (0 threads = one per core). Recipes keep file order and
+    // errors keep their absolute line numbers. Returns false if the file
+    // could not be opened.
+    static bool parseFileParallel(const std::string& filename,
+                                  LinkedList<Recipe*>& recipes, std::vector<ParseError>& errors,
+                                  unsigned threads = 0);
+};
@@ -0,0 +1,266 @@
+// src/RecipeStore.cpp
+// Implementation of the columnar RecipeStore.
+#include "RecipeStore.h"
+#include <cstring> // For std::memcmp
+#include <stdexcept>
+#include <algorithm> // For std::find
+
+// --- Constructor/Destructor ---
+RecipeStore::RecipeStore() : deadTitleBytes(0), liveCount(0) {}
+
+// Detaches every live recipe so none keeps a pointer to a destroyed store.
+RecipeStore::~RecipeStore() {
+    for (std::size_t i = 0; i < details.size(); ++i) {
+        if (details[i]) {
+            details[i]->detach();
+        }
+    }
+}
+
+// --- Membership ---
+// Appends the recipe's hot fields to every column and attaches the recipe.
+RecipeId RecipeStore::add(Recipe* recipe) {
+    if (!recipe) {
+        throw std::invalid_argument("Cannot add a null recipe to the store");
+    }
+    if (recipe->getId() != INVALID_RECIPE_ID) {
+        throw std::invalid_argument("Recipe already belongs to a store: " + recipe->getTitle());
+    }
+
+    RecipeId id = static_cast<RecipeId>(details.size());
+    prepTimes.push_back(static_cast<std::int32_t>(recipe->getPrepTime()));
+    mealTypes.push_back(static_cast<std::uint8_t>(recipe->getMealType()));
+    dietTypes.push_back(static_cast<std::uint8_t>(recipe->getDietType()));
+    live.push_back(1);
+    titleOffsets.push_back(0);
+    titleLengths.push_back(0);
+    details.push_back(recipe);
+    storeTitle(id, recipe->getTitle());
+    liveCount++;
+
+    recipe->attach(this, id);
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onRecipeAdded(*recipe);
+    }
+    return id;
+}
+
+// Adds every recipe of a freshly loaded list.
+void RecipeStore::addAll(const LinkedList<Recipe*>& recipes) {
+    for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
+        if (*it) add(*it);
+    }
+}
+
+// Tombstones the id and detaches the recipe. The recipe itself is not deleted.
+bool RecipeStore::remove(RecipeId id) {
+    if (!contains(id)) {
+        return false;
+    }
+    Recipe* recipe = details[id];
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onRecipeRemoved(*recipe); // Recipe still carries its id
+    }
+    details[id] = nullptr;
+    live[id] = 0;
+    deadTitleBytes += titleLengths[id];
+    titleLengths[id] = 0;
+    liveCount--;
+    recipe->detach();
+    return true;
+}
+
+bool RecipeStore::contains(RecipeId id) const {
+    return id >= 0 && id < idLimit() && live[id] != 0;
+}
+
+// --- Secondary Indexes ---
+void RecipeStore::addListener(RecipeListener* listener, bool replayExisting) {
+    listeners.push_back(listener);
+    if (!replayExisting) {
+        return;
+    }
+    for (std::size_t i = 0; i < details.size(); ++i) {
+        if (details[i]) listener->onRecipeAdded(*details[i]);
+    }
+}
+
+void RecipeStore::removeListener(RecipeListener* listener) {
+    std::vector<RecipeListener*>::iterator it = std::find(listeners.begin(), listeners.end(), listener);
+    if (it != listeners.end()) {
+        listeners.erase(it);
+    }
+}
+
+// --- Column Accessors ---
+Recipe* RecipeStore::get(RecipeId id) const {
+    return contains(id) ? details[id] : nullptr;
+}
+
+std::string RecipeStore::getTitle(RecipeId id) const {
+    return titleArena.substr(titleOffsets[id], titleLengths[id]);
+}
+
+int RecipeStore::getPrepTime(RecipeId id) const {
+    return prepTimes[id];
+}
+
+MealType RecipeStore::getMealType(RecipeId id) const {
+    return static_cast<MealType>(mealTypes[id]);
+}
+
+DietType RecipeStore::getDietType(RecipeId id) const {
+    return static_cast<DietType>(dietTypes[id]);
+}
+
+// --- Title Arena ---
+// Appends the title to the arena; the previous bytes become garbage that is
+// reclaimed once it outweighs the live titles.
+void RecipeStore::storeTitle(RecipeId id, const std::string& title) {
+    deadTitleBytes += titleLengths[id];
+    titleOffsets[id] = static_cast<std::uint32_t>(titleArena.size());
+    titleLengths[id] = static_cast<std::uint32_t>(title.size());
+    titleArena.append(title);
+    if (deadTitleBytes > 4096 && deadTitleBytes * 2 > titleArena.size()) {
+        compactTitles();
+    }
+}
+
+// Rewrites the arena with live titles only, in id order.
+void RecipeStore::compactTitles() {
+    std::string compacted;
+    compacted.reserve(titleArena.size() - deadTitleBytes);
+    for (std::size_t i = 0; i < details.size(); ++i) {
+        std::uint32_t offset = static_cast<std::uint32_t>(compacted.size());
+        compacted.append(titleArena, titleOffsets[i], titleLengths[i]);
+        titleOffsets[i] = offset;
+    }
+    titleArena.swap(compacted);
+    deadTitleBytes = 0;
+}
+
+bool RecipeStore::titleEquals(RecipeId id, const std::string& title) const {
+    return titleLengths[id] == title.size() &&
+           std::memcmp(titleArena.data() + titleOffsets[id], title.data(), title.size()) == 0;
+}
+
+// --- Column Scans ---
+// Exact title match, compared in place against the arena.
+std::vector<RecipeId> RecipeStore::findByTitle(const std::string& title) const {
+    std::vector<RecipeId> result;
+    for (RecipeId id = 0; id < idLimit(); ++id) {
+        if (live[id] && titleEquals(id, title)) {
+            result.push_back(id);
+        }
+    }
+    return result;
+}
+
+std::vector<RecipeId> RecipeStore::findByMealType(MealType type) const {
+    std::vector<RecipeId> result;
+    const std::uint8_t wanted = static_cast<std::uint8_t>(type);
+    for (RecipeId id = 0; id < idLimit(); ++id) {
+        if (live[id] && mealTypes[id] == wanted) {
+            result.push_back(id);
+        }
+    }
+    return result;
+}
+
+std::vector<RecipeId> RecipeStore::findByDietType(DietType type) const {
+    std::vector<RecipeId> result;
+    const std::uint8_t wanted = static_cast<std::uint8_t>(type);
+    for (RecipeId id = 0; id < idLimit(); ++id) {
+        if (live[id] && dietTypes[id] == wanted) {
+            result.push_back(id);
+        }
+    }
+    return result;
+}
+
+std::vector<RecipeId> RecipeStore::findByMaxPrepTime(int maxMinutes) const {
+    std::vector<RecipeId> result;
+    for (RecipeId id = 0; id < idLimit(); ++id) {
+        if (live[id] && prepTimes[id] <= maxMinutes) {
+            result.push_back(id);
+        }
+    }
+    return result;
+}
+
+// --- Aggregation ---
+QuantityTotals RecipeStore::sumIngredient(const std::vector<RecipeId>& ids, IngredientId ingredient) const {
+    QuantityColumns columns;
+    columns.reserve(ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (!contains(ids[i])) continue;
+        const IngredientList& ingredients = details[ids[i]]->getIngredients();
+        for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+            if (it->getId() == ingredient) {
+                columns.push(it->getParsedQuantity(), it->getQuantity());
+                break; // A recipe holds each ingredient at most once
+            }
+        }
+    }
+    return columns.sum();
+}
+
+std::size_t RecipeStore::hotBytes() const {
+    return prepTimes.capacity() * sizeof(std::int32_t) +
+           mealTypes.capacity() + dietTypes.capacity() + live.capacity() +
+           (titleOffsets.capacity() + titleLengths.capacity()) * sizeof(std::uint32_t) +
+           titleArena.capacity();
+}
+
+// --- RecipeListener Hooks ---
+// A deleted recipe drops out of the store automatically.
+void RecipeStore::onRecipeRemoved(const Recipe& recipe) {
+    remove(recipe.getId());
+}
+
+void RecipeStore::onTitleChanged(const Recipe& recipe, const std::string& oldTitle) {
+    storeTitle(recipe.getId(), recipe.getTitle());
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onTitleChanged(recipe, oldTitle);
+    }
+}
+
+void RecipeStore::onPrepTimeChanged(const Recipe& recipe, int oldPrepTime) {
+    prepTimes[recipe.getId()] = static_cast<std::int32_t>(recipe.getPrepTime());
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onPrepTimeChanged(recipe, oldPrepTime);
+    }
+}
+
+void RecipeStore::onMealTypeChanged(const Recipe& recipe, MealType oldMealType) {
+    mealTypes[recipe.getId()] = static_cast<std::uint8_t>(recipe.getMealType());
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onMealTypeChanged(recipe, oldMealType);
+    }
+}
+
+void RecipeStore::onDietTypeChanged(const Recipe& recipe, DietType oldDietType) {
+    dietTypes[recipe.getId()] = static_cast<std::uint8_t>(recipe.getDietType());
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onDietTypeChanged(recipe, oldDietType);
+    }
+}
+
+// Ingredients are not stored in the hot columns; just forward.
+void RecipeStore::onIngredientAdded(const Recipe& recipe, const Ingredient& ingredient) {
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onIngredientAdded(recipe, ingredient);
+    }
+}
+
+void RecipeStore::onIngredientRemoved(const Recipe& recipe, const Ingredient& ingredient) {
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onIngredientRemoved(recipe, ingredient);
+    }
+}
+
+void RecipeStore::onIngredientEdited(const Recipe& recipe, const Ingredient& oldIngredient, const Ingredient& newIngredient) {
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        listeners[i]->onIngredientEdited(recipe, oldIngredient, newIngredient);
+    }
+}
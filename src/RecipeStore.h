@@ -0,0 +1,95 @@
+// src/RecipeStore.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Recipe.h"
+#include "LinkedList.h"
+#include "Quantity.h"
+
+// =============================
+// Columnar Recipe Store
+// - Hot scalar fields in parallel packed arrays indexed by RecipeId
+//   (prep time as int32, meal/diet as uint8, titles in one string arena)
+// - Stable ids: a removed recipe leaves a tombstone, ids are never reused
+// - Recipe objects stay the cold "detail" view behind get(id)
+// - Kept in sync through the RecipeListener hooks on each attached recipe,
+//   which are forwarded to any registered secondary indexes
+// =============================
+
+class RecipeStore : public RecipeListener {
+private:
+    // Hot columns (one entry per id ever assigned)
+    std::vector<std::int32_t> prepTimes;
+    std::vector<std::uint8_t> mealTypes;
+    std::vector<std::uint8_t> dietTypes;
+    std::vector<std::uint8_t> live;          // 0 for removed ids
+    std::vector<std::uint32_t> titleOffsets; // Into titleArena
+    std::vector<std::uint32_t> titleLengths;
+    std::string titleArena;                  // All titles back to back
+    std::size_t deadTitleBytes;              // Arena bytes no longer referenced
+
+    // Cold detail view (non-owning; null for removed ids)
+    std::vector<Recipe*> details;
+    int liveCount;
+
+    // Secondary indexes notified after the columns are updated (non-owning)
+    std::vector<RecipeListener*> listeners;
+
+    void storeTitle(RecipeId id, const std::string& title);
+    void compactTitles();
+    bool titleEquals(RecipeId id, const std::string& title) const;
+
+    // Not copyable: recipes point back at the store that attached them
+    RecipeStore(const RecipeStore&);
+    RecipeStore& operator=(const RecipeStore&);
+
+public:
+    RecipeStore();
+    ~RecipeStore();
+
+    // Membership
+    RecipeId add(Recipe* recipe);               // Attaches the recipe and returns its new id
+    void addAll(const LinkedList<Recipe*>& recipes);
+    bool remove(RecipeId id);                   // Detaches without deleting the recipe
+    bool contains(RecipeId id) const;
+
+    // Secondary indexes. A new listener is sent onRecipeAdded for every live
+    // recipe unless replayExisting is false (e.g. a journal of later changes).
+    void addListener(RecipeListener* listener, bool replayExisting = true);
+    void removeListener(RecipeListener* listener);
+
+    int size() const { return liveCount; }
+    RecipeId idLimit() const { return static_cast<RecipeId>(details.size()); } // One past the largest id
+
+    // Column accessors (id must be live)
+    Recipe* get(RecipeId id) const;
+    std::string getTitle(RecipeId id) const;
+    int getPrepTime(RecipeId id) const;
+    MealType getMealType(RecipeId id) const;
+    DietType getDietType(RecipeId id) const;
+
+    // Full scans over the packed columns, returned in id order
+    std::vector<RecipeId> findByTitle(const std::string& title) const;
+    std::vector<RecipeId> findByMealType(MealType type) const;
+    std::vector<RecipeId> findByDietType(DietType type) const;
+    std::vector<RecipeId> findByMaxPrepTime(int maxMinutes) const;
+
+    // Total quantity of one ingredient across the given recipes (removed ids
+    // are ignored); quantities are gathered into columns and summed in one pass
+    QuantityTotals sumIngredient(const std::vector<RecipeId>& ids, IngredientId ingredient) const;
+
+    // Approximate bytes held by the hot columns and title arena
+    std::size_t hotBytes() const;
+
+    // RecipeListener hooks
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onTitleChanged(const Recipe& recipe, const std::string& oldTitle) override;
+    void onPrepTimeChanged(const Recipe& recipe, int oldPrepTime) override;
+    void onMealTypeChanged(const Recipe& recipe, MealType oldMealType) override;
+    void onDietTypeChanged(const Recipe& recipe, DietType oldDietType) override;
+    void onIngredientAdded(const Recipe& recipe, const Ingredient& ingredient) override;
+    void onIngredientRemoved(const Recipe& recipe, const Ingredient& ingredient) override;
+    void onIngredientEdited(const Recipe& recipe, const Ingredient& oldIngredient, const Ingredient& newIngredient) override;
+};
@@ -0,0 +1,75 @@
+// src/ScaledRecipe.cpp
+// Read-time scaling of recipe quantities.
+#include "ScaledRecipe.h"
+#include <iostream>
+#include <stdexcept> // For invalid_argument
+
+ScaledRecipe::ScaledRecipe(const Recipe& recipe, double factor) : recipe(&recipe), factor(factor) {
+    if (!(factor > 0.0)) {
+        throw std::invalid_argument("Scaling factor must be positive");
+    }
+}
+
+double ScaledRecipe::servingFactor(int fromServings, int toServings) {
+    if (fromServings <= 0 || toServings <= 0) {
+        throw std::invalid_argument("Servings must be positive");
+    }
+    return static_cast<double>(toServings) / fromServings;
+}
+
+// --- Per-Ingredient Reads ---
+Quantity ScaledRecipe::getQuantity(const Ingredient& ingredient) const {
+    return ingredient.getParsedQuantity().scaled(factor);
+}
+
+std::string ScaledRecipe::getQuantityText(const Ingredient& ingredient) const {
+    std::string text;
+    ingredient.getParsedQuantity().appendScaledText(text, ingredient.getQuantity(), factor);
+    return text;
+}
+
+// --- Serialization ---
+std::string ScaledRecipe::serialize() const {
+    std::string line;
+    appendSerialized(line);
+    return line;
+}
+
+void ScaledRecipe::appendSerialized(std::string& out) const {
+    out += recipe->getTypeString();
+    out += '|';
+    out += recipe->getTitle();
+    out += '|';
+    out += std::to_string(recipe->getPrepTime());
+    out += '|';
+    out += mealTypeToString(recipe->getMealType());
+    out += '|';
+    out += dietTypeToString(recipe->getDietType());
+    out += '|';
+
+    const IngredientList& ingredients = recipe->getIngredients();
+    for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+        if (it != ingredients.begin()) out += ';';
+        out += it->getName();
+        out += ':';
+        it->getParsedQuantity().appendScaledText(out, it->getQuantity(), factor);
+    }
+}
+
+// --- Display ---
+void ScaledRecipe::display() const {
+    std::cout << "=== " << recipe->getTitle() << " (x" << factor << ") ===" << std::endl;
+    std::cout << "Prep Time: " << recipe->getPrepTime() << " minutes" << std::endl;
+    std::cout << "Meal Type: " << mealTypeToString(recipe->getMealType()) << std::endl;
+    std::cout << "Diet Type: " << dietTypeToString(recipe->getDietType()) << std::endl;
+
+    std::cout << "Ingredients:" << std::endl;
+    const IngredientList& ingredients = recipe->getIngredients();
+    if (ingredients.isEmpty()) {
+        std::cout << "  (No ingredients added yet)" << std::endl;
+    }
+    for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+        std::cout << "  - " << getQuantityText(*it) << " " << it->getName() << std::endl;
+    }
+    std::cout << "=====================" << std::endl;
+}
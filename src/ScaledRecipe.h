@@ -0,0 +1,42 @@
+// src/ScaledRecipe.h
+#pragma once
+
+#include <string>
+#include "Recipe.h"
+
+// =============================
+// Scaled Recipe View
+// - Multiplies a recipe's quantities by a serving factor when they are
+//   read, displayed or serialized; the recipe itself is never copied or
+//   changed, and no ingredient list is allocated
+// - Scaled text keeps each quantity's wording ("200g" x1.5 -> "300g");
+//   unmeasured quantities such as "to taste" stay as written
+// - A view must not outlive its recipe
+// =============================
+
+class ScaledRecipe {
+private:
+    const Recipe* recipe;
+    double factor;
+
+public:
+    // Throws std::invalid_argument unless factor > 0
+    ScaledRecipe(const Recipe& recipe, double factor);
+
+    // Factor that turns 'fromServings' into 'toServings'
+    static double servingFactor(int fromServings, int toServings);
+
+    const Recipe& getRecipe() const { return *recipe; }
+    double getFactor() const { return factor; }
+
+    // Per-ingredient reads
+    Quantity getQuantity(const Ingredient& ingredient) const;
+    std::string getQuantityText(const Ingredient& ingredient) const;
+
+    // Same line format as Recipe::serialize(); appendSerialized reuses the
+    // caller's buffer so batch exports allocate nothing per recipe
+    std::string serialize() const;
+    void appendSerialized(std::string& out) const;
+
+    void display() const;
+};
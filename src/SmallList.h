@@ -0,0 +1,169 @@
+// src/SmallList.h
+#pragma once
+
+#include <cstddef> // for size_t
+#include <stdexcept> // for std::out_of_range
+#include <iterator> // for iterator tags
+#include <type_traits> // for std::aligned_storage
+
+// =============================
+// Unrolled List (Template)
+// - Elements live in segments of N slots; the first segment is stored
+//   inline in the list object, further segments are heap chunks
+// - Short lists (up to N elements) never allocate, and iteration is a
+//   contiguous scan within each segment
+// - Same iterator API as LinkedList (bidirectional, -- on end() gives the
+//   last element)
+// - Invariant: only the inline segment may be empty, and only when the
+//   whole list is
+// =============================
+
+template <typename T, std::size_t N = 8>
+class SmallList {
+private:
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+    // Bookkeeping first, so a short scan touches the lines holding the
+    // first elements and not one past the last slot
+    struct Segment {
+        std::size_t used;
+        Segment* next;
+        Segment* prev;
+        Slot slots[N];
+
+        Segment() : used(0), next(nullptr), prev(nullptr) {}
+        T* at(std::size_t i) { return reinterpret_cast<T*>(&slots[i]); }
+        const T* at(std::size_t i) const { return reinterpret_cast<const T*>(&slots[i]); }
+    };
+
+    Segment first;  // Inline segment
+    Segment* tail;  // Last segment (&first while nothing has overflowed)
+    int count;
+
+    template <typename U>
+    void append(U&& value);
+    void takeFrom(SmallList& other);
+    void foldNext(Segment* segment);
+
+public:
+    // --- Iterator ---
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+
+        iterator(Segment* segment = nullptr, std::size_t index = 0, const SmallList* list = nullptr)
+            : m_segment(segment), m_index(index), m_list(list) {}
+
+        reference operator*() const { return *m_segment->at(m_index); }
+        pointer operator->() const { return m_segment->at(m_index); }
+        iterator& operator++() {
+            if (++m_index == m_segment->used) { m_segment = m_segment->next; m_index = 0; }
+            return *this;
+        }
+        iterator operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+        iterator& operator--() {
+            if (m_segment && m_index > 0) { --m_index; return *this; }
+            m_segment = m_segment ? m_segment->prev : m_list->tail;
+            m_index = m_segment->used - 1;
+            return *this;
+        }
+        iterator operator--(int) { iterator tmp = *this; --(*this); return tmp; }
+
+        friend bool operator== (const iterator& a, const iterator& b) { return a.m_segment == b.m_segment && a.m_index == b.m_index; }
+        friend bool operator!= (const iterator& a, const iterator& b) { return !(a == b); }
+
+    private:
+        friend class SmallList;
+        Segment* m_segment; // nullptr for end()
+        std::size_t m_index;
+        const SmallList* m_list; // For stepping back from end()
+    };
+    // --- End Iterator ---
+
+    // --- Const Iterator ---
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = const T;
+        using pointer           = const T*;
+        using reference         = const T&;
+
+        const_iterator(const Segment* segment = nullptr, std::size_t index = 0, const SmallList* list = nullptr)
+            : m_segment(segment), m_index(index), m_list(list) {}
+        const_iterator(const iterator& it) : m_segment(it.m_segment), m_index(it.m_index), m_list(it.m_list) {}
+
+        reference operator*() const { return *m_segment->at(m_index); }
+        pointer operator->() const { return m_segment->at(m_index); }
+        const_iterator& operator++() {
+            if (++m_index == m_segment->used) { m_segment = m_segment->next; m_index = 0; }
+            return *this;
+        }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+        const_iterator& operator--() {
+            if (m_segment && m_index > 0) { --m_index; return *this; }
+            m_segment = m_segment ? m_segment->prev : m_list->tail;
+            m_index = m_segment->used - 1;
+            return *this;
+        }
+        const_iterator operator--(int) { const_iterator tmp = *this; --(*this); return tmp; }
+
+        friend bool operator== (const const_iterator& a, const const_iterator& b) { return a.m_segment == b.m_segment && a.m_index == b.m_index; }
+        friend bool operator!= (const const_iterator& a, const const_iterator& b) { return !(a == b); }
+
+    private:
+        const Segment* m_segment;
+        std::size_t m_index;
+        const SmallList* m_list;
+    };
+    // --- End Const Iterator ---
+
+    SmallList();
+    ~SmallList();
+
+    // Copies are deep; moves relink the other list's heap segments and move
+    // its inline elements, leaving it empty
+    SmallList(const SmallList& other);
+    SmallList(SmallList&& other);
+    SmallList& operator=(const SmallList& other);
+    SmallList& operator=(SmallList&& other);
+
+    void push_back(const T& value);
+    void push_back(T&& value);
+
+    // Removes one element and returns the element after it. Elements shift
+    // within the segment and half-empty neighbours are folded together, so
+    // other iterators are invalidated; end() throws out_of_range
+    iterator erase(iterator position);
+
+    int size() const { return count; }
+    bool isEmpty() const { return count == 0; }
+    void clear(); // Destroys all elements and frees the heap segments
+
+    // Segments in use, the inline one included
+    std::size_t segmentCount() const;
+    static std::size_t inlineCapacity() { return N; }
+
+    // Iterator support
+    iterator begin() { return count ? iterator(&first, 0, this) : end(); }
+    iterator end() { return iterator(nullptr, 0, this); }
+    const_iterator begin() const { return count ? const_iterator(&first, 0, this) : end(); }
+    const_iterator end() const { return const_iterator(nullptr, 0, this); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // Reverse iteration
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+};
+
+// Include the template implementation file
+#include "SmallList.tpp"
@@ -0,0 +1,174 @@
+// src/SmallList.tpp
+// Implementation for SmallList template class
+
+#include <new> // For placement new
+#include <utility> // For std::move, std::forward
+
+// --- Constructors/Destructor ---
+template <typename T, std::size_t N>
+SmallList<T, N>::SmallList() : tail(&first), count(0) {}
+
+template <typename T, std::size_t N>
+SmallList<T, N>::~SmallList() {
+    clear();
+}
+
+template <typename T, std::size_t N>
+SmallList<T, N>::SmallList(const SmallList& other) : tail(&first), count(0) {
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+        append(*it);
+    }
+}
+
+template <typename T, std::size_t N>
+SmallList<T, N>::SmallList(SmallList&& other) : tail(&first), count(0) {
+    takeFrom(other);
+}
+
+template <typename T, std::size_t N>
+SmallList<T, N>& SmallList<T, N>::operator=(const SmallList& other) {
+    if (this != &other) {
+        clear();
+        for (const_iterator it = other.begin(); it != other.end(); ++it) {
+            append(*it);
+        }
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+SmallList<T, N>& SmallList<T, N>::operator=(SmallList&& other) {
+    if (this != &other) {
+        clear();
+        takeFrom(other);
+    }
+    return *this;
+}
+
+// Moves the inline elements of 'other' and relinks its heap segments.
+// Expects this list to be empty.
+template <typename T, std::size_t N>
+void SmallList<T, N>::takeFrom(SmallList& other) {
+    for (std::size_t i = 0; i < other.first.used; ++i) {
+        new (first.at(i)) T(std::move(*other.first.at(i)));
+        other.first.at(i)->~T();
+    }
+    first.used = other.first.used;
+    first.next = other.first.next;
+    if (first.next) first.next->prev = &first;
+    tail = (other.tail == &other.first) ? &first : other.tail;
+    count = other.count;
+
+    other.first.used = 0;
+    other.first.next = nullptr;
+    other.tail = &other.first;
+    other.count = 0;
+}
+
+template <typename T, std::size_t N>
+void SmallList<T, N>::clear() {
+    Segment* segment = &first;
+    while (segment != nullptr) {
+        Segment* next = segment->next;
+        for (std::size_t i = 0; i < segment->used; ++i) {
+            segment->at(i)->~T();
+        }
+        if (segment != &first) delete segment;
+        segment = next;
+    }
+    first.used = 0;
+    first.next = nullptr;
+    tail = &first;
+    count = 0;
+}
+
+// --- Insertion ---
+template <typename T, std::size_t N>
+template <typename U>
+void SmallList<T, N>::append(U&& value) {
+    if (tail->used == N) {
+        Segment* segment = new Segment();
+        segment->prev = tail;
+        tail->next = segment;
+        tail = segment;
+    }
+    new (tail->at(tail->used)) T(std::forward<U>(value));
+    ++tail->used;
+    ++count;
+}
+
+template <typename T, std::size_t N>
+void SmallList<T, N>::push_back(const T& value) {
+    append(value);
+}
+
+template <typename T, std::size_t N>
+void SmallList<T, N>::push_back(T&& value) {
+    append(std::move(value));
+}
+
+// --- Removal ---
+template <typename T, std::size_t N>
+typename SmallList<T, N>::iterator SmallList<T, N>::erase(iterator position) {
+    Segment* segment = position.m_segment;
+    if (segment == nullptr) {
+        throw std::out_of_range("SmallList::erase: cannot erase end()");
+    }
+    std::size_t index = position.m_index;
+
+    // Close the gap within the segment
+    segment->at(index)->~T();
+    for (std::size_t i = index + 1; i < segment->used; ++i) {
+        new (segment->at(i - 1)) T(std::move(*segment->at(i)));
+        segment->at(i)->~T();
+    }
+    --segment->used;
+    --count;
+
+    // An emptied heap segment is unlinked
+    if (segment->used == 0 && segment != &first) {
+        Segment* next = segment->next;
+        segment->prev->next = next;
+        if (next) next->prev = segment->prev; else tail = segment->prev;
+        delete segment;
+        return iterator(next, 0, this);
+    }
+
+    // Fold neighbours together while they fit in one segment, so erasures
+    // cannot leave a chain of nearly empty segments (and the inline segment
+    // is refilled before anything behind it)
+    if (segment->next && segment->used + segment->next->used <= N) {
+        foldNext(segment);
+    }
+    if (segment->prev && segment->prev->used + segment->used <= N) {
+        index += segment->prev->used;
+        segment = segment->prev;
+        foldNext(segment);
+    }
+
+    return index < segment->used ? iterator(segment, index, this) : iterator(segment->next, 0, this);
+}
+
+// Moves the elements of the segment after 'segment' onto its end and frees it
+template <typename T, std::size_t N>
+void SmallList<T, N>::foldNext(Segment* segment) {
+    Segment* next = segment->next;
+    for (std::size_t i = 0; i < next->used; ++i) {
+        new (segment->at(segment->used + i)) T(std::move(*next->at(i)));
+        next->at(i)->~T();
+    }
+    segment->used += next->used;
+    segment->next = next->next;
+    if (next->next) next->next->prev = segment; else tail = segment;
+    delete next;
+}
+
+// --- Inspection ---
+template <typename T, std::size_t N>
+std::size_t SmallList<T, N>::segmentCount() const {
+    std::size_t segments = 0;
+    for (const Segment* segment = &first; segment != nullptr; segment = segment->next) {
+        ++segments;
+    }
+    return segments;
+}
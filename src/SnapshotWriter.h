@@ -0,0 +1,84 @@
+// src/SnapshotWriter.h
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Recipe.h"
+#include "LinkedList.h"
+#include "RecipeListener.h"
+#include "ThreadPool.h"
+
+// =============================
+// Atomic Snapshot Writer
+// - Serializes recipes into large blocks (no per-line flushes)
+// - Writes "<file>.tmp", fsyncs it and renames it over the target, so a
+//   crash or error leaves either the old or the new snapshot, never half of one
+// - writeAsync() runs on a background worker against a SnapshotView, an
+//   immutable capture of the serialized lines taken on the caller's thread
+// =============================
+
+typedef std::shared_ptr<const std::string> SnapshotLine;
+
+// Serialized recipes (without newlines) in list order at capture time.
+struct SnapshotView {
+    std::vector<SnapshotLine> lines;
+    std::size_t bytes; // Size of the written file
+
+    SnapshotView() : bytes(0) {}
+    void append(const SnapshotLine& line);
+    std::uint32_t checksum() const; // CRC-32 of the written file
+};
+
+// Copy-on-write line cache kept current through the store's listener hooks.
+// A change drops the recipe's cached line; views captured earlier keep theirs.
+class SnapshotCache : public RecipeListener {
+private:
+    std::vector<SnapshotLine> lines; // By RecipeId; null when stale
+
+    void invalidate(const Recipe& recipe);
+
+public:
+    // Only recipes changed since the last capture are serialized again.
+    SnapshotView capture(const LinkedList<Recipe*>& recipes);
+
+    // RecipeListener hooks (every change invalidates)
+    void onRecipeRemoved(const Recipe& recipe) override { invalidate(recipe); }
+    void onTitleChanged(const Recipe& recipe, const std::string&) override { invalidate(recipe); }
+    void onPrepTimeChanged(const Recipe& recipe, int) override { invalidate(recipe); }
+    void onMealTypeChanged(const Recipe& recipe, MealType) override { invalidate(recipe); }
+    void onDietTypeChanged(const Recipe& recipe, DietType) override { invalidate(recipe); }
+    void onIngredientAdded(const Recipe& recipe, const Ingredient&) override { invalidate(recipe); }
+    void onIngredientRemoved(const Recipe& recipe, const Ingredient&) override { invalidate(recipe); }
+    void onIngredientEdited(const Recipe& recipe, const Ingredient&, const Ingredient&) override { invalidate(recipe); }
+};
+
+class SnapshotWriter {
+public:
+    static const std::size_t BLOCK_SIZE = 1 << 20; // Bytes per write
+
+    SnapshotWriter();
+    ~SnapshotWriter(); // Finishes any queued write
+
+    // Synchronous writes. Throw std::runtime_error on failure (target untouched).
+    static void write(const std::string& filename, const LinkedList<Recipe*>& recipes);
+    static void write(const std::string& filename, const SnapshotView& view);
+    // Every recipe scaled by 'factor' (see ScaledRecipe), e.g. for batch cooking
+    static void writeScaled(const std::string& filename, const LinkedList<Recipe*>& recipes, double factor);
+
+    // Queues a background write; 'onDurable' runs on the worker after the rename.
+    void writeAsync(const std::string& filename, const SnapshotView& view,
+                    const std::function<void()>& onDurable = std::function<void()>());
+
+    // Blocks until queued writes finish; rethrows the first failure.
+    void wait();
+
+private:
+    ThreadPool worker; // One thread, so writes land in submission order
+
+    // Not copyable: owns the worker
+    SnapshotWriter(const SnapshotWriter&);
+    SnapshotWriter& operator=(const SnapshotWriter&);
+};
@@ -0,0 +1,106 @@
+// src/SortedViews.cpp
+// Implementation of the maintained title / prep-time / meal-type orders.
+#include "SortedViews.h"
+#include "Recipe.h"
+#include <algorithm> // For std::lower_bound, std::merge, std::sort
+
+// --- Ordering ---
+bool SortedViews::less(SortOrder order, RecipeId a, RecipeId b) const {
+    switch (order) {
+        case SortOrder::Title: {
+            int compared = titles[a].compare(titles[b]);
+            if (compared != 0) return compared < 0;
+            break;
+        }
+        case SortOrder::PrepTime:
+            if (prepTimes[a] != prepTimes[b]) return prepTimes[a] < prepTimes[b];
+            break;
+        case SortOrder::MealType:
+            if (mealTypes[a] != mealTypes[b]) return mealTypes[a] < mealTypes[b];
+            break;
+    }
+    return a < b;
+}
+
+// --- Maintenance ---
+void SortedViews::mergeAdded() const {
+    if (added.empty()) return;
+    for (int i = 0; i < SORT_ORDER_COUNT; ++i) {
+        const SortOrder order = static_cast<SortOrder>(i);
+        std::vector<RecipeId>& view = views[i];
+        std::sort(added.begin(), added.end(), [this, order](RecipeId a, RecipeId b) { return less(order, a, b); });
+        std::vector<RecipeId> merged(view.size() + added.size());
+        std::merge(view.begin(), view.end(), added.begin(), added.end(), merged.begin(),
+                   [this, order](RecipeId a, RecipeId b) { return less(order, a, b); });
+        view.swap(merged);
+    }
+    added.clear();
+}
+
+void SortedViews::insert(SortOrder order, RecipeId id) {
+    std::vector<RecipeId>& view = views[static_cast<int>(order)];
+    view.insert(std::lower_bound(view.begin(), view.end(), id,
+                    [this, order](RecipeId a, RecipeId b) { return less(order, a, b); }), id);
+}
+
+void SortedViews::erase(SortOrder order, RecipeId id) {
+    std::vector<RecipeId>& view = views[static_cast<int>(order)];
+    std::vector<RecipeId>::iterator position = std::lower_bound(view.begin(), view.end(), id,
+        [this, order](RecipeId a, RecipeId b) { return less(order, a, b); });
+    if (position != view.end() && *position == id) {
+        view.erase(position);
+    }
+}
+
+// --- Lookups ---
+const std::vector<RecipeId>& SortedViews::view(SortOrder order) const {
+    mergeAdded();
+    return views[static_cast<int>(order)];
+}
+
+// --- RecipeListener Hooks ---
+// Keys are updated only after the old position is erased, since finding
+// it needs the old key
+void SortedViews::onRecipeAdded(const Recipe& recipe) {
+    const std::size_t id = static_cast<std::size_t>(recipe.getId());
+    if (id >= titles.size()) {
+        titles.resize(id + 1);
+        prepTimes.resize(id + 1, 0);
+        mealTypes.resize(id + 1, 0);
+    }
+    titles[id] = recipe.getTitle();
+    prepTimes[id] = recipe.getPrepTime();
+    mealTypes[id] = static_cast<std::uint8_t>(recipe.getMealType());
+    added.push_back(recipe.getId());
+    count++;
+}
+
+void SortedViews::onRecipeRemoved(const Recipe& recipe) {
+    mergeAdded();
+    for (int i = 0; i < SORT_ORDER_COUNT; ++i) {
+        erase(static_cast<SortOrder>(i), recipe.getId());
+    }
+    std::string().swap(titles[recipe.getId()]);
+    count--;
+}
+
+void SortedViews::onTitleChanged(const Recipe& recipe, const std::string&) {
+    mergeAdded();
+    erase(SortOrder::Title, recipe.getId());
+    titles[recipe.getId()] = recipe.getTitle();
+    insert(SortOrder::Title, recipe.getId());
+}
+
+void SortedViews::onPrepTimeChanged(const Recipe& recipe, int) {
+    mergeAdded();
+    erase(SortOrder::PrepTime, recipe.getId());
+    prepTimes[recipe.getId()] = recipe.getPrepTime();
+    insert(SortOrder::PrepTime, recipe.getId());
+}
+
+void SortedViews::onMealTypeChanged(const Recipe& recipe, MealType) {
+    mergeAdded();
+    erase(SortOrder::MealType, recipe.getId());
+    mealTypes[recipe.getId()] = static_cast<std::uint8_t>(recipe.getMealType());
+    insert(SortOrder::MealType, recipe.getId());
+}
@@ -0,0 +1,59 @@
+// src/SortedViews.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Recipe.h"
+#include "RecipeListener.h"
+
+// Orders kept by SortedViews; each matches the Recipe::compareBy* comparator
+// of the same name, with ties in id (insertion) order
+enum class SortOrder {
+    Title,
+    PrepTime,
+    MealType
+};
+
+const int SORT_ORDER_COUNT = static_cast<int>(SortOrder::MealType) + 1;
+
+// =============================
+// Sorted Views (maintained secondary orders)
+// - One vector of recipe ids per SortOrder, kept ordered by (key, id), so
+//   switching orders is picking a vector and listing is a straight walk
+// - Edits and removals move one id by binary search in the views they
+//   affect; adds are buffered and merged into every view on the next read,
+//   so loading n recipes costs O(n log n) rather than n vector inserts
+// - Maintained incrementally as a RecipeStore listener; reads merge the
+//   add buffer, so concurrent readers need external locking
+// =============================
+
+class SortedViews : public RecipeListener {
+private:
+    std::vector<std::string> titles;     // Sort keys by RecipeId, as last notified
+    std::vector<std::int32_t> prepTimes;
+    std::vector<std::uint8_t> mealTypes;
+    mutable std::vector<RecipeId> views[SORT_ORDER_COUNT];
+    mutable std::vector<RecipeId> added; // Not yet merged into the views
+    int count;
+
+    bool less(SortOrder order, RecipeId a, RecipeId b) const;
+    void mergeAdded() const;
+    void insert(SortOrder order, RecipeId id);
+    void erase(SortOrder order, RecipeId id);
+
+public:
+    SortedViews() : count(0) {}
+
+    // Every recipe's id in the given order
+    const std::vector<RecipeId>& view(SortOrder order) const;
+
+    int size() const { return count; }
+
+    // RecipeListener hooks
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onTitleChanged(const Recipe& recipe, const std::string& oldTitle) override;
+    void onPrepTimeChanged(const Recipe& recipe, int oldPrepTime) override;
+    void onMealTypeChanged(const Recipe& recipe, MealType oldMealType) override;
+};
@@ -0,0 +1,79 @@
+// src/ThreadPool.cpp
+// Implementation of the fixed-size worker pool.
+#include "ThreadPool.h"
+
+unsigned ThreadPool::defaultThreadCount() {
+    unsigned count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+ThreadPool::ThreadPool(unsigned threadCount) : pending(0), stopping(false) {
+    if (threadCount == 0) {
+        threadCount = defaultThreadCount();
+    }
+    for (unsigned i = 0; i < threadCount; ++i) {
+        workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+    }
+}
+
+// Finishes queued work, then joins every worker.
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskReady.notify_all();
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+}
+
+void ThreadPool::submit(const std::function<void()>& task) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        tasks.push(task);
+        pending++;
+    }
+    taskReady.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (pending > 0) {
+        allDone.wait(lock);
+    }
+    if (failure) {
+        std::exception_ptr error = failure;
+        failure = std::exception_ptr();
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!stopping && tasks.empty()) {
+                taskReady.wait(lock);
+            }
+            if (tasks.empty()) {
+                return; // Stopping and nothing left to run
+            }
+            task = tasks.front();
+            tasks.pop();
+        }
+
+        try {
+            task();
+        } catch (...) {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!failure) failure = std::current_exception();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (--pending == 0) {
+            allDone.notify_all();
+        }
+    }
+}
@@ -0,0 +1,45 @@
+// src/ThreadPool.h
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// =============================
+// Fixed-size worker pool
+// - submit() queues a task; wait() blocks until every queued task finished
+// - The first exception thrown by a task is rethrown from wait()
+// =============================
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()> > tasks;
+    std::mutex mutex;
+    std::condition_variable taskReady;
+    std::condition_variable allDone;
+    unsigned pending;            // Queued + running tasks
+    bool stopping;
+    std::exception_ptr failure;  // First task exception since the last wait()
+
+    void workerLoop();
+
+    // Not copyable: owns threads
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+
+public:
+    // 0 threads means one per hardware thread
+    explicit ThreadPool(unsigned threadCount = 0);
+    ~ThreadPool();
+
+    void submit(const std::function<void()>& task);
+    void wait();
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()); }
+    static unsigned defaultThreadCount();
+};
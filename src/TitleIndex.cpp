@@ -0,0 +1,168 @@
+// src/TitleIndex.cpp
+// Implementation of the prefix / substring title index.
+#include "TitleIndex.h"
+#include "Recipe.h"
+#include <algorithm> // For std::lower_bound, std::merge, std::sort, std::unique
+#include <cctype>
+
+namespace {
+    const std::size_t MAX_GRAM = 3;
+
+    // Length in the top byte keeps grams of different lengths apart
+    std::uint32_t gramKey(const char* text, std::size_t length) {
+        std::uint32_t key = static_cast<std::uint32_t>(length) << 24;
+        for (std::size_t i = 0; i < length; ++i) {
+            key |= static_cast<std::uint32_t>(static_cast<unsigned char>(text[i])) << (16 - 8 * i);
+        }
+        return key;
+    }
+
+    // Distinct keys of every gram of 1..MAX_GRAM bytes in 'title'
+    std::vector<std::uint32_t> gramKeys(const std::string& title) {
+        std::vector<std::uint32_t> keys;
+        for (std::size_t length = 1; length <= MAX_GRAM; ++length) {
+            for (std::size_t i = 0; i + length <= title.size(); ++i) {
+                keys.push_back(gramKey(title.data() + i, length));
+            }
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        return keys;
+    }
+
+    bool shorterPostingList(const PostingList* a, const PostingList* b) {
+        return a->size() < b->size();
+    }
+}
+
+std::string TitleIndex::fold(const std::string& title) {
+    std::string folded(title);
+    for (std::size_t i = 0; i < folded.size(); ++i) {
+        folded[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(folded[i])));
+    }
+    return folded;
+}
+
+// --- Maintenance ---
+bool TitleIndex::titleLess(RecipeId a, RecipeId b) const {
+    int order = titles[a].compare(titles[b]);
+    return order < 0 || (order == 0 && a < b);
+}
+
+void TitleIndex::mergeAdded() const {
+    if (added.empty()) return;
+    std::sort(added.begin(), added.end(), [this](RecipeId a, RecipeId b) { return titleLess(a, b); });
+    std::vector<RecipeId> merged(byTitle.size() + added.size());
+    std::merge(byTitle.begin(), byTitle.end(), added.begin(), added.end(), merged.begin(),
+               [this](RecipeId a, RecipeId b) { return titleLess(a, b); });
+    byTitle.swap(merged);
+    added.clear();
+}
+
+void TitleIndex::insert(RecipeId id, const std::string& title) {
+    if (static_cast<std::size_t>(id) >= titles.size()) {
+        titles.resize(id + 1);
+    }
+    titles[id] = fold(title);
+
+    added.push_back(id);
+    insertPosting(allRecipes, id);
+
+    std::vector<std::uint32_t> keys = gramKeys(titles[id]);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        insertPosting(grams[keys[i]], id);
+    }
+}
+
+void TitleIndex::erase(RecipeId id) {
+    if (id < 0 || static_cast<std::size_t>(id) >= titles.size() || !erasePosting(allRecipes, id)) {
+        return;
+    }
+    mergeAdded();
+    std::vector<RecipeId>::iterator position = std::lower_bound(byTitle.begin(), byTitle.end(), id,
+        [this](RecipeId a, RecipeId b) { return titleLess(a, b); });
+    if (position != byTitle.end() && *position == id) {
+        byTitle.erase(position);
+    }
+
+    std::vector<std::uint32_t> keys = gramKeys(titles[id]);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        std::unordered_map<std::uint32_t, PostingList>::iterator gram = grams.find(keys[i]);
+        if (gram == grams.end()) continue;
+        erasePosting(gram->second, id);
+        if (gram->second.empty()) grams.erase(gram);
+    }
+    std::string().swap(titles[id]);
+}
+
+// --- Lookups ---
+const PostingList* TitleIndex::findGram(const char* text, std::size_t length) const {
+    std::unordered_map<std::uint32_t, PostingList>::const_iterator gram = grams.find(gramKey(text, length));
+    return gram == grams.end() ? nullptr : &gram->second;
+}
+
+std::vector<RecipeId> TitleIndex::findPrefix(const std::string& prefix, std::size_t limit) const {
+    mergeAdded();
+    const std::string folded = fold(prefix);
+    std::vector<RecipeId>::const_iterator it = std::lower_bound(byTitle.begin(), byTitle.end(), folded,
+        [this](RecipeId id, const std::string& value) { return titles[id] < value; });
+
+    std::vector<RecipeId> result;
+    for (; it != byTitle.end() && (limit == 0 || result.size() < limit); ++it) {
+        if (titles[*it].compare(0, folded.size(), folded) != 0) break;
+        result.push_back(*it);
+    }
+    return result;
+}
+
+PostingList TitleIndex::findSubstring(const std::string& text) const {
+    const std::string folded = fold(text);
+    if (folded.empty()) {
+        return allRecipes;
+    }
+    if (folded.size() <= MAX_GRAM) { // The gram itself is the answer
+        const PostingList* list = findGram(folded.data(), folded.size());
+        return list ? *list : PostingList();
+    }
+
+    std::vector<const PostingList*> lists;
+    for (std::size_t i = 0; i + MAX_GRAM <= folded.size(); ++i) {
+        const PostingList* list = findGram(folded.data() + i, MAX_GRAM);
+        if (!list) {
+            return PostingList(); // Some trigram appears in no title
+        }
+        lists.push_back(list);
+    }
+    std::sort(lists.begin(), lists.end()); // Repeated trigrams share one list
+    lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+    std::sort(lists.begin(), lists.end(), shorterPostingList);
+
+    PostingList candidates = *lists[0];
+    for (std::size_t i = 1; i < lists.size() && !candidates.empty(); ++i) {
+        candidates = intersectPostings(candidates, *lists[i]);
+    }
+
+    // Sharing every trigram does not make the query a substring: verify
+    PostingList result;
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        if (titles[candidates[i]].find(folded) != std::string::npos) {
+            result.push_back(candidates[i]);
+        }
+    }
+    return result;
+}
+
+// --- RecipeListener Hooks ---
+void TitleIndex::onRecipeAdded(const Recipe& recipe) {
+    erase(recipe.getId()); // No-op unless the recipe is already indexed
+    insert(recipe.getId(), recipe.getTitle());
+}
+
+void TitleIndex::onRecipeRemoved(const Recipe& recipe) {
+    erase(recipe.getId());
+}
+
+void TitleIndex::onTitleChanged(const Recipe& recipe, const std::string&) {
+    erase(recipe.getId());
+    insert(recipe.getId(), recipe.getTitle());
+}
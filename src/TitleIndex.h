@@ -0,0 +1,54 @@
+// src/TitleIndex.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "RecipeListener.h"
+#include "PostingList.h"
+
+// =============================
+// Title Index (case-insensitive)
+// - Prefix search: recipe ids kept sorted by folded title, so a prefix is
+//   one binary search plus the matching run (type-ahead)
+// - Substring search: every 1-, 2- and 3-byte gram of a folded title maps
+//   to a posting list. Short queries are a single gram lookup; longer ones
+//   intersect their trigram lists (shortest first) and verify the survivors
+// - Maintained incrementally as a RecipeStore listener; adds are buffered
+//   and merged into the title order on the next prefix lookup, so attaching
+//   to a large store costs one sort instead of an insert per recipe
+// =============================
+
+class TitleIndex : public RecipeListener {
+private:
+    std::vector<std::string> titles;   // Folded title by RecipeId ("" if not indexed)
+    mutable std::vector<RecipeId> byTitle; // Indexed ids ordered by (folded title, id)
+    mutable std::vector<RecipeId> added;   // Not yet merged into byTitle
+    std::unordered_map<std::uint32_t, PostingList> grams;
+    PostingList allRecipes;
+
+    bool titleLess(RecipeId a, RecipeId b) const;
+    void mergeAdded() const; // Sorts pending adds into byTitle in one pass
+    void insert(RecipeId id, const std::string& title);
+    void erase(RecipeId id);
+    const PostingList* findGram(const char* text, std::size_t length) const;
+
+public:
+    static std::string fold(const std::string& title); // ASCII lowercase copy
+
+    // Ids whose title starts with 'prefix', in title order; at most 'limit'
+    // results when limit > 0. An empty prefix matches every recipe.
+    std::vector<RecipeId> findPrefix(const std::string& prefix, std::size_t limit = 0) const;
+
+    // Ids whose title contains 'text', in id order
+    PostingList findSubstring(const std::string& text) const;
+
+    int size() const { return static_cast<int>(allRecipes.size()); }
+    std::size_t gramCount() const { return grams.size(); }
+
+    // RecipeListener hooks
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onTitleChanged(const Recipe& recipe, const std::string& oldTitle) override;
+};
@@ -0,0 +1,55 @@
+// src/TitleLookup.cpp
+// Implementation of the exact / case-insensitive title hash index.
+#include "TitleLookup.h"
+#include "TitleIndex.h" // For TitleIndex::fold
+#include "Recipe.h"
+
+namespace {
+    typedef std::unordered_map<std::string, PostingList> TitleMap;
+
+    void eraseId(TitleMap& map, const std::string& key, RecipeId id) {
+        TitleMap::iterator it = map.find(key);
+        if (it == map.end()) return;
+        erasePosting(it->second, id);
+        if (it->second.empty()) map.erase(it);
+    }
+
+    PostingList findIds(const TitleMap& map, const std::string& key) {
+        TitleMap::const_iterator it = map.find(key);
+        return it == map.end() ? PostingList() : it->second;
+    }
+}
+
+// --- Maintenance ---
+void TitleLookup::insert(const std::string& title, RecipeId id) {
+    insertPosting(exact[title], id);
+    insertPosting(folded[TitleIndex::fold(title)], id);
+}
+
+void TitleLookup::erase(const std::string& title, RecipeId id) {
+    eraseId(exact, title, id);
+    eraseId(folded, TitleIndex::fold(title), id);
+}
+
+// --- Lookups ---
+PostingList TitleLookup::find(const std::string& title) const {
+    return findIds(exact, title);
+}
+
+PostingList TitleLookup::findIgnoringCase(const std::string& title) const {
+    return findIds(folded, TitleIndex::fold(title));
+}
+
+// --- RecipeListener Hooks ---
+void TitleLookup::onRecipeAdded(const Recipe& recipe) {
+    insert(recipe.getTitle(), recipe.getId());
+}
+
+void TitleLookup::onRecipeRemoved(const Recipe& recipe) {
+    erase(recipe.getTitle(), recipe.getId());
+}
+
+void TitleLookup::onTitleChanged(const Recipe& recipe, const std::string& oldTitle) {
+    erase(oldTitle, recipe.getId());
+    insert(recipe.getTitle(), recipe.getId());
+}
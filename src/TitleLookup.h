@@ -0,0 +1,40 @@
+// src/TitleLookup.h
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include "RecipeListener.h"
+#include "PostingList.h"
+
+// =============================
+// Title Lookup (hash index)
+// - Exact title -> recipe ids and case-folded title -> recipe ids, so
+//   find / edit / remove by title are one hash probe instead of a scan
+// - Every id sharing a title is kept (in id order); callers decide what a
+//   duplicate means instead of getting whichever recipe came first
+// - Maintained incrementally as a RecipeStore listener, so renames and
+//   removals move or drop the entries
+// =============================
+
+class TitleLookup : public RecipeListener {
+private:
+    std::unordered_map<std::string, PostingList> exact;
+    std::unordered_map<std::string, PostingList> folded;
+
+    void insert(const std::string& title, RecipeId id);
+    void erase(const std::string& title, RecipeId id);
+
+public:
+    // Ids with exactly this title; empty if none
+    PostingList find(const std::string& title) const;
+
+    // Ids whose title equals this one ignoring ASCII case
+    PostingList findIgnoringCase(const std::string& title) const;
+
+    std::size_t titleCount() const { return exact.size(); } // Distinct exact titles
+
+    // RecipeListener hooks
+    void onRecipeAdded(const Recipe& recipe) override;
+    void onRecipeRemoved(const Recipe& recipe) override;
+    void onTitleChanged(const Recipe& recipe, const std::string& oldTitle) override;
+};
@@ -1,11 +1,12 @@
 // src/VeganRecipe.cpp
 #include "VeganRecipe.h"
 #include <iostream>
-#include <unordered_set>
+#include <utility> // For std::move
+#include <vector>
 #include <algorithm>
 
-VeganRecipe::VeganRecipe(const std::string& title, int prepTime, MealType mealType)
-    : Recipe(title, prepTime, mealType, DietType::Vegan) {}
+VeganRecipe::VeganRecipe(std::string title, int prepTime, MealType mealType)
+    : Recipe(std::move(title), prepTime, mealType, DietType::Vegan) {}
 
 void VeganRecipe::display() const {
     std::cout << "=== Vegan Recipe ===" << std::endl;
@@ -17,7 +18,7 @@ void VeganRecipe::display() const {
     if (ingredients.isEmpty()) {
         std::cout << "  (No ingredients added yet)" << std::endl;
     } else {
-        for (LinkedList<Ingredient>::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
+        for (IngredientList::const_iterator it = ingredients.begin(); it != ingredients.end(); ++it) {
             std::cout << "  - " << it->getName() << std::endl;
         }
     }
@@ -26,13 +27,11 @@ void VeganRecipe::display() const {
 
 bool VeganRecipe::isValidForDiet(const Ingredient& ingredient) const {
     // List of non-vegan ingredients
-    static const std::unordered_set<std::string> nonVeganIngredients = {
+    static const std::vector<IngredientId> nonVeganIngredients = IngredientPool::instance().internAll({
         "milk", "cheese", "butter", "cream", "yogurt", "honey", "eggs", "meat", "beef", "pork", "chicken", "fish",
         "seafood", "lard", "gelatin", "whey", "casein", "lactose", "shellfish", "poultry"
-    };
+    });
 
-    std::string lowerName = ingredient.getName();
-    std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
-    
-    return nonVeganIngredients.find(lowerName) == nonVeganIngredients.end();
+    // Interned ids are case-folded, so this is an integer search
+    return !std::binary_search(nonVeganIngredients.begin(), nonVeganIngredients.end(), ingredient.getId());
 }
@@ -5,7 +5,7 @@
 
 class VeganRecipe : public Recipe {
 public:
-    VeganRecipe(const std::string& title = "", 
+    VeganRecipe(std::string title = "", 
        int prepTime = 0, 
        MealType mealType = MealType::Other);
 
@@ -13,4 +13,10 @@ public:
     std::string getTypeString() const override { return "Vegan"; }
     bool isValidForDiet(const Ingredient& ingredient) const override;
     virtual ~VeganRecipe() = default;
+
+    // The declared destructor would suppress the implicit moves
+    VeganRecipe(const VeganRecipe&) = default;
+    VeganRecipe(VeganRecipe&&) = default;
+    VeganRecipe& operator=(const VeganRecipe&) = default;
+    VeganRecipe& operator=(VeganRecipe&&) = default;
 };
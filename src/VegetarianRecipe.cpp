@@ -1,12 +1,13 @@
 // src/VegetarianRecipe.cpp
 #include "VegetarianRecipe.h"
 #include <iostream>
-#include <unordered_set>
+#include <utility> // For std::move
+#include <vector>
 #include <algorithm>
 
 // Constructor definition
-VegetarianRecipe::VegetarianRecipe(const std::string& title, int prepTime, MealType mealType)
-    : Recipe(title, prepTime, mealType, DietType::Vegetarian) // Call base constructor, set DietType
+VegetarianRecipe::VegetarianRecipe(std::string title, int prepTime, MealType mealType)
+    : Recipe(std::move(title), prepTime, mealType, DietType::Vegetarian) // Call base constructor, set DietType
 {}
 
 // Override display method
@@ -30,12 +31,10 @@ void VegetarianRecipe::display() const {
 
 bool VegetarianRecipe::isValidForDiet(const Ingredient& ingredient) const {
     // List of non-vegetarian ingredients
-    static const std::unordered_set<std::string> nonVegetarianIngredients = {
+    static const std::vector<IngredientId> nonVegetarianIngredients = IngredientPool::instance().internAll({
         "meat", "beef", "pork", "chicken", "fish", "seafood", "lard", "gelatin", "shellfish", "poultry"
-    };
+    });
 
-    std::string lowerName = ingredient.getName();
-    std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
-    
-    return nonVegetarianIngredients.find(lowerName) == nonVegetarianIngredients.end();
+    // Interned ids are case-folded, so this is an integer search
+    return !std::binary_search(nonVegetarianIngredients.begin(), nonVegetarianIngredients.end(), ingredient.getId());
 }
@@ -6,7 +6,7 @@
 class VegetarianRecipe : public Recipe {
 public:
     // Constructor - forwards to base and sets specific DietType
-    VegetarianRecipe(const std::string& title = "", 
+    VegetarianRecipe(std::string title = "", 
        int prepTime = 0, 
        MealType mealType = MealType::Other);
 
@@ -16,6 +16,12 @@ public:
     // Virtual destructor
     virtual ~VegetarianRecipe() = default;
 
+    // Copy and move (the declared destructor would suppress the implicit moves)
+    VegetarianRecipe(const VegetarianRecipe&) = default;
+    VegetarianRecipe(VegetarianRecipe&&) = default;
+    VegetarianRecipe& operator=(const VegetarianRecipe&) = default;
+    VegetarianRecipe& operator=(VegetarianRecipe&&) = default;
+
     // Added getTypeString method
     std::string getTypeString() const override { return "Vegetarian"; }
 
@@ -8,6 +8,7 @@
 #include <sstream>
 #include <string>
 #include <limits>
+#include <vector>
 #include <stdexcept> // For exception handling during parsing
 
 #include "LinkedList.h"
@@ -15,6 +16,19 @@
 #include "VegetarianRecipe.h"
 #include "VeganRecipe.h"
 #include "OmnivoreRecipe.h"
+#include "RecipeStore.h"
+#include "IngredientIndex.h"
+#include "TitleIndex.h"
+#include "TitleLookup.h"
+#include "RecipeHandles.h"
+#include "FuzzySearch.h"
+#include "BitmapIndex.h"
+#include "PrepTimeIndex.h"
+#include "SortedViews.h"
+#include "QueryEngine.h"
+#include "RecipeParser.h"
+#include "RecipeJournal.h"
+#include "SnapshotWriter.h"
 
 
 
@@ -23,23 +37,52 @@ const std::string RECIPE_FILE = "recipes.txt";
 //Function Prototypes
 int driver();
 void displayMenu();
-void addRecipe(LinkedList<Recipe*>& recipes);
-void listRecipes(const LinkedList<Recipe*>& recipes);
+void addRecipe(LinkedList<Recipe*>& recipes, RecipeStore& store);
+void listRecipes(const LinkedList<Recipe*>& recipes, const RecipeStore& store, const std::vector<RecipeId>* order = nullptr);
 void addIngredientsToRecipe(LinkedList<Recipe*>& recipes);
 void saveRecipes(const LinkedList<Recipe*>& recipes);
 void loadRecipes(LinkedList<Recipe*>& recipes);
 MealType getMealTypeInput();
 DietType getDietTypeInput();
 Recipe* createRecipeFromData(const std::string& title, int prepTime, MealType mealType, DietType dietType);
-Recipe* findRecipeByTitle(LinkedList<Recipe*>& recipes, const std::string& title); // Helper Prototype
-void removeRecipe(LinkedList<Recipe*>& recipes); // Prototype
-void editRecipe(LinkedList<Recipe*>& recipes); // Prototype
-void searchRecipes(const LinkedList<Recipe*>& recipes);
-void sortRecipes(LinkedList<Recipe*>& recipes);
+Recipe* findRecipeByTitle(const RecipeStore& store, const TitleLookup& titles, const std::string& title); // Helper Prototype
+void removeRecipe(RecipeHandles& handles, const RecipeStore& store, const TitleLookup& titles); // Prototype
+void editRecipe(const RecipeStore& store, const TitleLookup& titles); // Prototype
+void searchRecipes(const RecipeStore& store, const IngredientIndex& ingredientIndex, const TitleIndex& titleIndex,
+                   const FuzzySearch& fuzzySearch, const BitmapIndex& bitmapIndex, const PrepTimeIndex& prepTimeIndex,
+                   const QueryEngine& queryEngine);
+bool displayRecipeIds(const RecipeStore& store, const std::vector<RecipeId>& ids);
+void sortRecipes(const LinkedList<Recipe*>& recipes, bool& viewSelected, SortOrder& listOrder);
 
 int driver() {
     LinkedList<Recipe*> recipeList;
     loadRecipes(recipeList);
+    RecipeStore recipeStore; // Columnar view used by search
+    recipeStore.addAll(recipeList);
+    IngredientIndex ingredientIndex;
+    recipeStore.addListener(&ingredientIndex);
+    TitleIndex titleIndex;
+    recipeStore.addListener(&titleIndex);
+    TitleLookup titleLookup;
+    recipeStore.addListener(&titleLookup);
+    RecipeHandles recipeHandles(recipeList); // For O(1) removal from the list
+    recipeStore.addListener(&recipeHandles);
+    FuzzySearch fuzzySearch(ingredientIndex);
+    recipeStore.addListener(&fuzzySearch);
+    BitmapIndex bitmapIndex;
+    recipeStore.addListener(&bitmapIndex);
+    PrepTimeIndex prepTimeIndex;
+    recipeStore.addListener(&prepTimeIndex);
+    QueryEngine queryEngine(recipeStore, ingredientIndex, titleIndex, bitmapIndex, prepTimeIndex);
+    SortedViews sortedViews;
+    recipeStore.addListener(&sortedViews);
+    RecipeJournal journal(RECIPE_FILE); // Logs every change as it happens
+    int recovered = journal.open(recipeList, recipeStore);
+    if (recovered > 0) {
+        std::cout << "Recovered " << recovered << " change(s) from " << journal.getJournalFile() << "." << std::endl;
+    }
+    bool viewSelected = false; // Listing follows the catalog until a sort is picked
+    SortOrder listOrder = SortOrder::Title;
 
     int choice = 0;
     while (choice != 8) {
@@ -58,34 +101,40 @@ int driver() {
 
         switch (choice) {
             case 1:
-                addRecipe(recipeList);
+                addRecipe(recipeList, recipeStore);
                 break;
             case 2:
-                listRecipes(recipeList);
+                listRecipes(recipeList, recipeStore, viewSelected ? &sortedViews.view(listOrder) : nullptr);
                 break;
             case 3:
                 addIngredientsToRecipe(recipeList);
                 break;
             case 4:
-                editRecipe(recipeList); 
+                editRecipe(recipeStore, titleLookup); 
                 break;
             case 5: 
-                removeRecipe(recipeList); 
+                removeRecipe(recipeHandles, recipeStore, titleLookup); 
                 break;
             case 6:
-                searchRecipes(recipeList);
+                searchRecipes(recipeStore, ingredientIndex, titleIndex, fuzzySearch, bitmapIndex, prepTimeIndex, queryEngine);
                 break;
             case 7:
-                sortRecipes(recipeList);
+                sortRecipes(recipeList, viewSelected, listOrder);
                 break;
             case 8: 
                 std::cout << "Saving recipes and exiting." << std::endl;
-                saveRecipes(recipeList);
+                if (journal.journalRecords() > 0) {
+                    journal.compact(); // Folds every logged change into recipes.txt
+                }
+                journal.sync();
                 break;
             default:
                 std::cout << "Invalid choice. Please try again." << std::endl;
                 break;
         }
+        if (choice != 8 && journal.needsCompaction()) {
+            journal.compact(); // Snapshot is written in the background
+        }
         std::cout << std::endl;
     }
 
@@ -110,12 +159,16 @@ void displayMenu() {
     std::cout << "--------------------------------------------------\n\n";
 }
 
-void addRecipe(LinkedList<Recipe*>& recipes) {
+void addRecipe(LinkedList<Recipe*>& recipes, RecipeStore& store) {
     std::string title, mealStr, dietStr;
     int prepTime;
 
     std::cout << "\nEnter recipe title: ";
     std::getline(std::cin, title); 
+    if (!Recipe::isValidTitle(title)) {
+        std::cout << "\nTitle cannot contain '|' or line breaks. Recipe not added.\n";
+        return;
+    }
 
     std::cout << "\nEnter prep time (minutes): ";
     while (!(std::cin >> prepTime) || prepTime <= 0) { 
@@ -133,6 +186,7 @@ void addRecipe(LinkedList<Recipe*>& recipes) {
          Recipe* newRecipe = createRecipeFromData(title, prepTime, mealType, dietType);
          if(newRecipe) {
             recipes.push_back(newRecipe); // Just push pointer
+            store.add(newRecipe);
             std::cout << "\nRecipe '" << title << "' added successfully!\n";
          } else {
              std::cout << "\nFailed to create recipe (unknown diet type?).\n";
@@ -146,10 +200,15 @@ void addRecipe(LinkedList<Recipe*>& recipes) {
     // TODO: Add recipe sorting options
 }
 
-void listRecipes(const LinkedList<Recipe*>& recipes) {
+void listRecipes(const LinkedList<Recipe*>& recipes, const RecipeStore& store, const std::vector<RecipeId>* order) {
     std::cout << "\n--- Listing All Recipes ---" << std::endl;
     if (recipes.isEmpty()) {
         std::cout << "No recipes available." << std::endl;
+    } else if (order) { // A maintained sort order: walk its ids
+        for (std::size_t i = 0; i < order->size(); ++i) {
+            std::cout << "\nRecipe #" << i + 1 << ":\n";
+            store.get((*order)[i])->display();
+        }
     } else {
         int i = 1;
         for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
@@ -166,44 +225,23 @@ void listRecipes(const LinkedList<Recipe*>& recipes) {
 }
 
 void saveRecipes(const LinkedList<Recipe*>& recipes) {
-    std::ofstream outFile(RECIPE_FILE);
-    if (!outFile) {
-        std::cerr << "Error: Could not open file " << RECIPE_FILE << " for writing." << std::endl;
-        return;
-    }
-
-    for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
-        Recipe* recipePtr = *it;
-        if (recipePtr) {
-            outFile << recipePtr->serialize() << std::endl;
-        }
+    try {
+        SnapshotWriter::write(RECIPE_FILE, recipes); // Old file survives a failed write
+    } catch (const std::runtime_error& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
     }
-    outFile.close();
 }
 
 void loadRecipes(LinkedList<Recipe*>& recipes) {
-    std::ifstream inFile(RECIPE_FILE);
-    if (!inFile) {
+    std::vector<ParseError> errors;
+    if (!RecipeParser::parseFileParallel(RECIPE_FILE, recipes, errors)) {
         // File not existing is not an error on first run
         return;
     }
 
-    std::string line;
-    int lineNumber = 0;
-    while (std::getline(inFile, line)) {
-        lineNumber++;
-        if (line.empty()) continue;
-
-        try {
-            Recipe* recipe = Recipe::deserialize(line);
-            if (recipe) {
-                recipes.push_back(recipe);
-            }
-        } catch (const std::exception& e) {
-            std::cerr << "Warning [Line " << lineNumber << "]: Error deserializing recipe: " << e.what() << std::endl;
-        }
+    for (std::vector<ParseError>::const_iterator it = errors.begin(); it != errors.end(); ++it) {
+        std::cerr << "Warning [Line " << it->line() << "]: Error deserializing recipe: " << it->what() << std::endl;
     }
-    inFile.close();
 }
 
 // Basic saving: Title,PrepTime,MealTypeStr,DietTypeStr
@@ -230,11 +268,8 @@ void addIngredientsToRecipe(LinkedList<Recipe*>& recipes) {
     }
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-    // Get iterator to the selected recipe
-    LinkedList<Recipe*>::iterator it = recipes.begin();
-    for (int i = 1; i < choice; ++i) {
-        ++it;
-    }
+    // Get iterator to the selected recipe (skip index, not a walk from the head)
+    LinkedList<Recipe*>::iterator it = recipes.iteratorAt(choice - 1);
 
     std::cout << "\nAdding ingredients to: " << (*it)->getTitle() << std::endl;
     std::cout << "Enter ingredients (empty line to finish):\n";
@@ -257,7 +292,13 @@ void addIngredientsToRecipe(LinkedList<Recipe*>& recipes) {
         quantity = quantity.substr(0, quantity.find_last_not_of(" \t") + 1);
 
         if (!name.empty()) {
-            (*it)->addIngredient(Ingredient(name, quantity));
+            try {
+                (*it)->addIngredient(Ingredient(name, quantity));
+            } catch (const std::invalid_argument& e) {
+                // Duplicate (names compare case-insensitively) or not allowed for this diet
+                std::cout << "Not added: " << e.what() << std::endl;
+                continue;
+            }
             std::cout << "Added: " << name;
             if (!quantity.empty()) std::cout << " (" << quantity << ")";
             std::cout << std::endl;
@@ -336,16 +377,39 @@ Recipe* createRecipeFromData(const std::string& title, int prepTime, MealType me
 }
 
 // Helper function to find a recipe by title (returns non-owning pointer)
-Recipe* findRecipeByTitle(LinkedList<Recipe*>& recipes, const std::string& title) {
-    for (LinkedList<Recipe*>::iterator it = recipes.begin(); it != recipes.end(); ++it) {
-        if ((*it) && (*it)->getTitle() == title) {
-            return *it; // Return raw pointer
-        }
+// Exact title first, then ignoring case. When several recipes share the
+// title, they are listed and the user picks one.
+Recipe* findRecipeByTitle(const RecipeStore& store, const TitleLookup& titles, const std::string& title) {
+    PostingList ids = titles.find(title);
+    if (ids.empty()) {
+        ids = titles.findIgnoringCase(title);
+    }
+    if (ids.empty()) {
+        return nullptr; // Not found
+    }
+    if (ids.size() == 1) {
+        return store.get(ids[0]);
+    }
+
+    std::cout << ids.size() << " recipes are titled '" << title << "':" << std::endl;
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        Recipe* recipe = store.get(ids[i]);
+        std::cout << i + 1 << ". " << recipe->getTitle() << " (" << recipe->getPrepTime() << " minutes, "
+                  << mealTypeToString(recipe->getMealType()) << ", " << dietTypeToString(recipe->getDietType()) << ")" << std::endl;
     }
-    return nullptr; // Not found
+    std::cout << "Which one? ";
+    int choice;
+    if (!(std::cin >> choice) || choice < 1 || choice > static_cast<int>(ids.size())) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "Invalid choice." << std::endl;
+        return nullptr;
+    }
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    return store.get(ids[choice - 1]);
 }
 
-void removeRecipe(LinkedList<Recipe*>& recipes) {
+void removeRecipe(RecipeHandles& handles, const RecipeStore& store, const TitleLookup& titles) {
     std::cout << "Enter the exact title of the recipe to remove: ";
     std::string titleToRemove;
     std::getline(std::cin, titleToRemove);
@@ -355,8 +419,7 @@ void removeRecipe(LinkedList<Recipe*>& recipes) {
         return;
     }
 
-    // Use the find helper first to confirm existence
-    Recipe* foundRecipe = findRecipeByTitle(recipes, titleToRemove);
+    Recipe* foundRecipe = findRecipeByTitle(store, titles, titleToRemove);
 
     if (!foundRecipe) {
         std::cout << "Recipe '" << titleToRemove << "' not found." << std::endl;
@@ -369,15 +432,9 @@ void removeRecipe(LinkedList<Recipe*>& recipes) {
     std::getline(std::cin, confirmation);
 
     if (confirmation == "y" || confirmation == "Y") {
-        bool removed = recipes.removeIf([&titleToRemove](Recipe* recipe_ptr) {
-            if (recipe_ptr && recipe_ptr->getTitle() == titleToRemove) {
-                delete recipe_ptr; // Free memory
-                return true;
-            }
-            return false;
-        });
-
+        bool removed = handles.erase(*foundRecipe); // O(1) through its list position
         if (removed) {
+            delete foundRecipe; // Free memory (also detaches it from the store and indexes)
             std::cout << "Recipe '" << titleToRemove << "' removed successfully." << std::endl;
         } else {
             std::cout << "Error: Recipe '" << titleToRemove << "' could not be removed (already removed or error?)." << std::endl;
@@ -387,7 +444,7 @@ void removeRecipe(LinkedList<Recipe*>& recipes) {
     }
 }
 
-void editRecipe(LinkedList<Recipe*>& recipes) {
+void editRecipe(const RecipeStore& store, const TitleLookup& titles) {
     std::cout << "Enter the exact title of the recipe to edit: ";
     std::string titleToEdit;
     std::getline(std::cin, titleToEdit);
@@ -397,7 +454,7 @@ void editRecipe(LinkedList<Recipe*>& recipes) {
         return;
     }
 
-    Recipe* recipeToEdit = findRecipeByTitle(recipes, titleToEdit);
+    Recipe* recipeToEdit = findRecipeByTitle(store, titles, titleToEdit);
 
     if (!recipeToEdit) {
         std::cout << "Recipe '" << titleToEdit << "' not found." << std::endl;
@@ -432,12 +489,14 @@ void editRecipe(LinkedList<Recipe*>& recipes) {
                 std::string newTitle;
                 std::cout << "Enter new title: ";
                 std::getline(std::cin, newTitle);
-                if (!newTitle.empty()) {
+                if (newTitle.empty()) {
+                    std::cout << "Title cannot be empty. Not updated." << std::endl;
+                } else if (!Recipe::isValidTitle(newTitle)) {
+                    std::cout << "Title cannot contain '|' or line breaks. Not updated." << std::endl;
+                } else {
                     recipeToEdit->setTitle(newTitle);
                     std::cout << "Title updated." << std::endl;
                     titleToEdit = newTitle; 
-                } else {
-                    std::cout << "Title cannot be empty. Not updated." << std::endl;
                 }
                 break;
             }
@@ -471,7 +530,17 @@ void editRecipe(LinkedList<Recipe*>& recipes) {
     }
 }
 
-void searchRecipes(const LinkedList<Recipe*>& recipes) {
+// Displays every recipe in the id list; returns whether there were any.
+bool displayRecipeIds(const RecipeStore& store, const std::vector<RecipeId>& ids) {
+    for (std::vector<RecipeId>::const_iterator it = ids.begin(); it != ids.end(); ++it) {
+        store.get(*it)->display();
+    }
+    return !ids.empty();
+}
+
+void searchRecipes(const RecipeStore& store, const IngredientIndex& ingredientIndex, const TitleIndex& titleIndex,
+                   const FuzzySearch& fuzzySearch, const BitmapIndex& bitmapIndex, const PrepTimeIndex& prepTimeIndex,
+                   const QueryEngine& queryEngine) {
     std::cout << "\n========================================\n";
     std::cout << "           Search Recipes               \n";
     std::cout << "========================================\n";
@@ -479,11 +548,14 @@ void searchRecipes(const LinkedList<Recipe*>& recipes) {
     std::cout << "| 2. Search by ingredient              |\n";
     std::cout << "| 3. Search by meal type               |\n";
     std::cout << "| 4. Search by diet type               |\n";
+    std::cout << "| 5. Fuzzy search (allows typos)       |\n";
+    std::cout << "| 6. Query (diet, meal, prep, ...)     |\n";
+    std::cout << "| 7. Quick recipes (max prep time)     |\n";
     std::cout << "========================================\n";
     std::cout << "Choice: ";
 
     int choice;
-    if (!(std::cin >> choice) || choice < 1 || choice > 4) {
+    if (!(std::cin >> choice) || choice < 1 || choice > 7) {
         std::cout << "Invalid choice." << std::endl;
         return;
     }
@@ -494,55 +566,67 @@ void searchRecipes(const LinkedList<Recipe*>& recipes) {
 
     switch (choice) {
         case 1: {
-            std::cout << "Enter title to search: ";
+            std::cout << "Enter title or part of a title to search: ";
             std::getline(std::cin, searchTerm);
-            for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
-                Recipe* recipePtr = *it;
-                if (recipePtr->matchesTitle(searchTerm)) {
-                    recipePtr->display();
-                    found = true;
-                }
-            }
+            found = displayRecipeIds(store, titleIndex.findSubstring(searchTerm));
             break;
         }
         case 2: {
-            std::cout << "Enter ingredient to search: ";
+            std::cout << "Enter ingredient to search (e.g. tomato AND basil AND NOT cheese): ";
             std::getline(std::cin, searchTerm);
-            for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
-                Recipe* recipePtr = *it;
-                if (recipePtr->matchesIngredient(searchTerm)) {
-                    recipePtr->display();
-                    found = true;
-                }
-            }
+            found = displayRecipeIds(store, ingredientIndex.query(searchTerm));
             break;
         }
         case 3: {
             std::cout << "Enter meal type to search: ";
             std::getline(std::cin, searchTerm);
-            MealType searchMealType = stringToMealType(searchTerm);
-            for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
-                Recipe* recipePtr = *it;
-                if (recipePtr->getMealType() == searchMealType) {
-                    recipePtr->display();
-                    found = true;
-                }
-            }
+            found = displayRecipeIds(store, bitmapIndex.withMealType(stringToMealType(searchTerm)).toPostingList());
             break;
         }
         case 4: {
             std::cout << "Enter diet type to search: ";
             std::getline(std::cin, searchTerm);
-            DietType searchDietType = stringToDietType(searchTerm);
-            for (LinkedList<Recipe*>::const_iterator it = recipes.begin(); it != recipes.end(); ++it) {
-                Recipe* recipePtr = *it;
-                if (recipePtr->getDietType() == searchDietType) {
-                    recipePtr->display();
-                    found = true;
+            found = displayRecipeIds(store, bitmapIndex.withDietType(stringToDietType(searchTerm)).toPostingList());
+            break;
+        }
+        case 5: {
+            std::cout << "Enter title words or an ingredient (e.g. mozarella): ";
+            std::getline(std::cin, searchTerm);
+            std::vector<FuzzyHit> hits = fuzzySearch.search(searchTerm);
+            std::vector<RecipeId> ids;
+            for (std::size_t i = 0; i < hits.size(); ++i) ids.push_back(hits[i].id); // Best match first
+            found = displayRecipeIds(store, ids);
+            break;
+        }
+        case 6: {
+            std::cout << "Enter a query (e.g. EXPLAIN diet:vegan meal:dinner prep<30 ing:spinach sort:prep limit:20): ";
+            std::getline(std::cin, searchTerm);
+            try {
+                Query query = Query::parse(searchTerm);
+                QueryResult result = queryEngine.run(query);
+                if (query.explain) {
+                    std::cout << "\n" << result.explain();
                 }
+                found = displayRecipeIds(store, result.ids);
+            } catch (const std::invalid_argument& e) {
+                std::cout << "Invalid query: " << e.what() << std::endl;
+                return;
             }
             break;
         }
+        case 7: {
+            std::cout << "Enter the most minutes you have: ";
+            int maxMinutes;
+            if (!(std::cin >> maxMinutes)) {
+                std::cin.clear();
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::cout << "Invalid number." << std::endl;
+                return;
+            }
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            found = displayRecipeIds(store, prepTimeIndex.fastest(prepTimeIndex.size(), maxMinutes)); // Quickest first
+            break;
+        }
     }
 
     if (!found) {
@@ -550,35 +634,61 @@ void searchRecipes(const LinkedList<Recipe*>& recipes) {
     }
 }
 
-void sortRecipes(LinkedList<Recipe*>& recipes) {
+// Picking an order only selects one of the maintained views; the catalog
+// itself (and the saved file) keeps its order
+void sortRecipes(const LinkedList<Recipe*>& recipes, bool& viewSelected, SortOrder& listOrder) {
+    const std::size_t SHOWN = 10;
     std::cout << "\n========================================\n";
     std::cout << "             Sort Recipes               \n";
     std::cout << "========================================\n";
     std::cout << "| 1. Sort by title                     |\n";
     std::cout << "| 2. Sort by prep time                 |\n";
     std::cout << "| 3. Sort by meal type                 |\n";
+    std::cout << "| 4. Show the 10 quickest recipes      |\n";
+    std::cout << "| 5. Show the first 10 titles (A-Z)    |\n";
+    std::cout << "| 6. Back to catalog order             |\n";
     std::cout << "========================================\n";
     std::cout << "Choice: ";
 
     int choice;
-    if (!(std::cin >> choice) || choice < 1 || choice > 3) {
+    if (!(std::cin >> choice) || choice < 1 || choice > 6) {
         std::cout << "Invalid choice." << std::endl;
         return;
     }
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
+    std::vector<Recipe*> shown;
     switch (choice) {
         case 1:
-            recipes.sort(Recipe::compareByTitle);
-            std::cout << "Recipes sorted by title." << std::endl;
-            break;
+            viewSelected = true;
+            listOrder = SortOrder::Title;
+            std::cout << "Recipes will be listed by title." << std::endl;
+            return;
         case 2:
-            recipes.sort(Recipe::compareByPrepTime);
-            std::cout << "Recipes sorted by prep time." << std::endl;
-            break;
+            viewSelected = true;
+            listOrder = SortOrder::PrepTime;
+            std::cout << "Recipes will be listed by prep time." << std::endl;
+            return;
         case 3:
-            recipes.sort(Recipe::compareByMealType);
-            std::cout << "Recipes sorted by meal type." << std::endl;
+            viewSelected = true;
+            listOrder = SortOrder::MealType;
+            std::cout << "Recipes will be listed by meal type." << std::endl;
+            return;
+        case 4:
+            shown = recipes.topK(SHOWN, Recipe::compareByPrepTime);
             break;
+        case 5:
+            shown = recipes.topK(SHOWN, Recipe::compareByTitle);
+            break;
+        case 6:
+            viewSelected = false;
+            std::cout << "Recipes will be listed in catalog order." << std::endl;
+            return;
+    }
+    for (std::size_t i = 0; i < shown.size(); ++i) {
+        shown[i]->display();
+    }
+    if (shown.empty()) {
+        std::cout << "No recipes to show." << std::endl;
     }
 }
@@ -2,11 +2,38 @@
 #include <iostream>
 #include "driver.h"
 #include "testDriver.h"
+#include "RecipeManager.h"
 
 
 bool TEST = false;//test flag
 
-int main() {
+// Converts between the text and binary catalog formats:
+//   recipe-manager --to-binary recipes.txt recipes.bin
+//   recipe-manager --to-text recipes.bin recipes.txt
+int convertCatalog(const std::string& mode, const std::string& from, const std::string& to) {
+    try {
+        int converted = 0;
+        if (mode == "--to-binary") {
+            converted = RecipeManager::convertTextToBinary(from, to);
+        } else if (mode == "--to-text") {
+            converted = RecipeManager::convertBinaryToText(from, to);
+        } else {
+            std::cerr << "Unknown option " << mode << " (expected --to-binary or --to-text)" << std::endl;
+            return 1;
+        }
+        std::cout << "Converted " << converted << " recipes from " << from << " to " << to << "." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Conversion failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    if (argc == 4) {
+        return convertCatalog(argv[1], argv[2], argv[3]);
+    }
 
     if (TEST) {
         std::cout << "Running in test mode." << std::endl;
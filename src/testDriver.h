@@ -1,17 +1,44 @@
 // Recipe Manager - Test Driver Program
 #include <iostream>
 #include <cassert>
+#include <cstdint>
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <limits>
 #include <stdexcept>
+#include <algorithm> // For std::stable_sort
+#include <functional> // For std::less
+#include <vector>
+#include <cstring> // For std::memcpy
+#include <iterator> // For std::istreambuf_iterator
 
 #include "LinkedList.h"
+#include "SmallList.h"
 #include "Recipe.h"
 #include "VegetarianRecipe.h"
 #include "VeganRecipe.h"
 #include "OmnivoreRecipe.h"
+#include "RecipeStore.h"
+#include "IngredientIndex.h"
+#include "TitleIndex.h"
+#include "TitleLookup.h"
+#include "RecipeHandles.h"
+#include "FuzzySearch.h"
+#include "BitmapIndex.h"
+#include "PrepTimeIndex.h"
+#include "SortedViews.h"
+#include "QueryEngine.h"
+#include "BinaryCatalog.h"
+#include "RecipeManager.h"
+#include "RecipeParser.h"
+#include "RecipeJournal.h"
+#include "Checksum.h"
+#include "SnapshotWriter.h"
+#include "GroceryList.h"
+#include "ScaledRecipe.h"
+#include "ThreadPool.h"
+#include <cstdio> // For std::remove
 
 
 // Function prototypes for test cases
@@ -23,6 +50,31 @@ void testRemoveRecipe();
 void testEditRecipe();
 void testSearchRecipes();
 void testSortRecipes();
+void testLinkedListPooling();
+void testLinkedListSorting();
+void testRecipeStore();
+void testIngredientIndex();
+void testBinaryCatalog();
+void testRecipeParser();
+void testParallelLoading();
+void testRecipeJournal();
+void testSnapshotWriter();
+void testIngredientPool();
+void testQuantity();
+void testGroceryList();
+void testScaledRecipe();
+void testTitleIndex();
+void testFuzzySearch();
+void testBitmapIndex();
+void testQueryEngine();
+void testPrepTimeIndex();
+void testTopK();
+void testSortedViews();
+void testTitleLookup();
+void testLinkedListErase();
+void testLinkedListIteration();
+void testSmallList();
+void testCopyAndMove();
 
 
 int testDriver() {
@@ -36,6 +88,31 @@ int testDriver() {
   testEditRecipe();
   testSearchRecipes();
   testSortRecipes();
+  testLinkedListPooling();
+  testLinkedListSorting();
+  testRecipeStore();
+  testIngredientIndex();
+  testBinaryCatalog();
+  testRecipeParser();
+  testParallelLoading();
+  testRecipeJournal();
+  testSnapshotWriter();
+  testIngredientPool();
+  testQuantity();
+  testGroceryList();
+  testScaledRecipe();
+  testTitleIndex();
+  testFuzzySearch();
+  testBitmapIndex();
+  testQueryEngine();
+  testPrepTimeIndex();
+  testTopK();
+  testSortedViews();
+  testTitleLookup();
+  testLinkedListErase();
+  testLinkedListIteration();
+  testSmallList();
+  testCopyAndMove();
 
   std::cout << "All tests passed!\n";
 
@@ -92,7 +169,7 @@ void testAddIngredientsToRecipe(){
 
   assert(recipe->getIngredients().size() == 2);
 
-  LinkedList<Ingredient>::const_iterator it = recipe->getIngredients().begin();
+  IngredientList::const_iterator it = recipe->getIngredients().begin();
   assert(it != recipe->getIngredients().end() && it->getName() == "Flour");
   assert(it != recipe->getIngredients().end() && it->getQuantity() == "2 cups");
   ++it;
@@ -112,10 +189,13 @@ void testListRecipes() {
   recipes.push_back(recipe1);
   recipes.push_back(recipe2);
 
+  RecipeStore store;
+  store.addAll(recipes);
+
   std::ostringstream output;
   std::streambuf* oldCout = std::cout.rdbuf(output.rdbuf());
 
-  listRecipes(recipes);
+  listRecipes(recipes, store);
 
   std::cout.rdbuf(oldCout);
   std::string result = output.str();
@@ -169,6 +249,38 @@ void testRemoveRecipe() {
   });
 
   assert(recipes.isEmpty());
+
+  // Through RecipeHandles, as the menu does: O(1) erase by list position
+  for (int i = 0; i < 5; ++i) {
+    recipes.push_back(createRecipeFromData("Dish " + std::to_string(i), 10 + i, MealType::Dinner, DietType::Vegan));
+  }
+  RecipeStore store;
+  store.addAll(recipes);
+  RecipeHandles handles(recipes);
+  store.addListener(&handles); // Replayed recipes are located by one rebuild
+  Recipe* second = *recipes.iteratorAt(1);
+  assert(handles.erase(*second));
+  delete second;
+  assert(recipes.size() == 4 && (*recipes.iteratorAt(1))->getTitle() == "Dish 2");
+
+  Recipe* added = createRecipeFromData("Late Dish", 5, MealType::Snack, DietType::Vegan);
+  recipes.push_back(added);
+  store.add(added); // Found at the tail
+  recipes.sort([](Recipe* a, Recipe* b) { return a->getPrepTime() < b->getPrepTime(); }); // Relinks, handles stay valid
+  assert(*recipes.begin() == added);
+  assert(handles.erase(*added));
+  delete added;
+  assert(recipes.size() == 4);
+  Recipe* first = *recipes.begin();
+  assert(handles.erase(*first) && !handles.erase(*first)); // Already unlinked the second time
+  delete first;
+  assert(recipes.size() == 3);
+
+  Recipe* stray = createRecipeFromData("Not Listed", 1, MealType::Other, DietType::Vegan);
+  assert(!handles.erase(*stray)); // Not in a store
+  delete stray;
+  recipes.clear();
+  assert(store.size() == 0);
 }
 
 void testEditRecipe() {
@@ -197,10 +309,16 @@ void testSearchRecipes() {
 
   recipes.push_back(recipe1);
   recipes.push_back(recipe2);
+  RecipeStore store;
+  store.addAll(recipes);
+  TitleLookup titles;
+  store.addListener(&titles);
 
-  Recipe* foundRecipe = findRecipeByTitle(recipes, "Searchable Recipe");
+  Recipe* foundRecipe = findRecipeByTitle(store, titles, "Searchable Recipe");
   assert(foundRecipe != nullptr);
   assert(foundRecipe->getTitle() == "Searchable Recipe");
+  assert(findRecipeByTitle(store, titles, "another recipe") == recipe2); // Falls back to ignoring case
+  assert(findRecipeByTitle(store, titles, "Missing Recipe") == nullptr);
 
   // Cleanup
   recipes.clear();
@@ -240,3 +358,1721 @@ void testSortRecipes() {
 }
 
 
+
+
+void testLinkedListPooling() {
+  std::cout << "Testing LinkedList node pooling...\n";
+  LinkedList<int> pooled;
+  LinkedList<int> perNode(NodeAllocation::PerNode);
+  assert(pooled.getAllocation() == NodeAllocation::Pooled);
+  assert(perNode.getAllocation() == NodeAllocation::PerNode);
+
+  // Spill across several chunks
+  for (int i = 0; i < 100; ++i) {
+    pooled.push_back(i);
+    perNode.push_back(i);
+  }
+  assert(pooled.size() == 100);
+  assert(perNode.size() == 100);
+
+  // Freed slots are recycled by later insertions
+  assert(pooled.remove(0));
+  assert(pooled.remove(50));
+  pooled.push_back(100);
+  assert(pooled.size() == 99);
+
+  int expected = 1;
+  for (LinkedList<int>::iterator it = pooled.begin(); it != pooled.end(); ++it) {
+    if (expected == 50) expected++;
+    assert(*it == expected);
+    expected++;
+  }
+
+  // The list is reusable after its chunks are released
+  pooled.clear();
+  assert(pooled.isEmpty());
+  pooled.push_back(7);
+  assert(pooled.size() == 1 && *pooled.begin() == 7);
+}
+
+
+// Orders pairs by their first member only, so stability is observable
+bool compareFirst(const std::pair<int, int>& a, const std::pair<int, int>& b) {
+  return a.first < b.first;
+}
+
+// Checks order, stability and that prev/tail mirror the next chain
+void checkSortedPairs(const LinkedList<std::pair<int, int> >& list, int expectedSize) {
+  assert(list.size() == expectedSize);
+  int seen = 0;
+  auto* node = list.getHead();
+  decltype(node) previous = nullptr;
+  while (node) {
+    assert(node->prev == previous);
+    if (previous) {
+      assert(previous->value.first < node->value.first ||
+             (previous->value.first == node->value.first && previous->value.second < node->value.second));
+    }
+    previous = node;
+    node = node->next;
+    seen++;
+  }
+  assert(seen == expectedSize);
+  assert(list.getTail() == previous);
+}
+
+void testLinkedListSorting() {
+  std::cout << "Testing LinkedList sorting...\n";
+  const int N = 1000;
+
+  // Random keys with many duplicates; second member records original order
+  LinkedList<std::pair<int, int> > merged;
+  LinkedList<std::pair<int, int> > inserted;
+  LinkedList<std::pair<int, int> > adaptive;
+  for (int i = 0; i < N; ++i) {
+    int key = (i * 7919) % 37;
+    merged.push_back(std::make_pair(key, i));
+    inserted.push_back(std::make_pair(key, i));
+    adaptive.push_back(std::make_pair(key, i));
+  }
+  merged.mergeSort(compareFirst);
+  inserted.insertionSort(compareFirst);
+  adaptive.sort(compareFirst);
+  checkSortedPairs(merged, N);
+  checkSortedPairs(inserted, N);
+  checkSortedPairs(adaptive, N);
+
+  // Nearly sorted and reversed input through the adaptive policy
+  LinkedList<std::pair<int, int> > nearlySorted;
+  LinkedList<std::pair<int, int> > reversed;
+  for (int i = 0; i < N; ++i) {
+    nearlySorted.push_back(std::make_pair(i % 100 == 0 ? i + 5 : i, i));
+    reversed.push_back(std::make_pair(N - i, i));
+  }
+  nearlySorted.sort(compareFirst);
+  reversed.sort(compareFirst);
+  checkSortedPairs(nearlySorted, N);
+  checkSortedPairs(reversed, N);
+
+  // push_back after sorting must append behind the new tail
+  reversed.push_back(std::make_pair(N + 1, N));
+  assert(reversed.getTail()->value.first == N + 1);
+  assert(reversed.getTail()->prev->value.first == N);
+}
+
+
+void testRecipeStore() {
+  std::cout << "Testing RecipeStore...\n";
+  LinkedList<Recipe*> recipes;
+  recipes.push_back(createRecipeFromData("Pancakes", 20, MealType::Breakfast, DietType::Vegetarian));
+  recipes.push_back(createRecipeFromData("Smoothie", 5, MealType::Breakfast, DietType::Vegan));
+  recipes.push_back(createRecipeFromData("Steak", 25, MealType::Dinner, DietType::Omnivore));
+
+  RecipeStore store;
+  store.addAll(recipes);
+  assert(store.size() == 3);
+
+  LinkedList<Recipe*>::iterator it = recipes.begin();
+  Recipe* pancakes = *it++;
+  Recipe* smoothie = *it++;
+  Recipe* steak = *it;
+  assert(pancakes->getId() == 0 && smoothie->getId() == 1 && steak->getId() == 2);
+  assert(store.get(1) == smoothie);
+
+  assert(store.findByMealType(MealType::Breakfast).size() == 2);
+  assert(store.findByDietType(DietType::Vegan).size() == 1);
+  assert(store.findByMaxPrepTime(20).size() == 2);
+  assert(store.findByTitle("Steak").size() == 1 && store.findByTitle("Steak")[0] == 2);
+
+  // Setters keep the columns in sync
+  steak->setTitle("Ribeye Steak");
+  steak->setPrepTime(10);
+  steak->setMealType(MealType::Lunch);
+  assert(store.getTitle(2) == "Ribeye Steak");
+  assert(store.findByTitle("Steak").empty());
+  assert(store.getPrepTime(2) == 10);
+  assert(store.findByMealType(MealType::Lunch).size() == 1);
+
+  // Deleting a recipe drops it from the store; ids are never reused
+  recipes.removeIf([smoothie](Recipe* r) {
+    if (r == smoothie) {
+      delete r;
+      return true;
+    }
+    return false;
+  });
+  assert(store.size() == 2);
+  assert(!store.contains(1) && store.get(1) == nullptr);
+  assert(store.findByDietType(DietType::Vegan).empty());
+
+  Recipe* soup = createRecipeFromData("Soup", 30, MealType::Lunch, DietType::Vegan);
+  recipes.push_back(soup);
+  assert(store.add(soup) == 3);
+
+  // Explicit removal detaches without deleting
+  assert(store.remove(0));
+  assert(pancakes->getId() == INVALID_RECIPE_ID);
+  assert(store.size() == 2);
+
+  // Cleanup
+  recipes.clear();
+  assert(store.size() == 0);
+}
+
+
+void testIngredientIndex() {
+  std::cout << "Testing IngredientIndex...\n";
+  LinkedList<Recipe*> recipes;
+  Recipe* caprese = createRecipeFromData("Caprese", 10, MealType::Lunch, DietType::Vegetarian);
+  caprese->addIngredient(Ingredient("tomato", "100g"));
+  caprese->addIngredient(Ingredient("basil", "10g"));
+  caprese->addIngredient(Ingredient("cheese", "80g"));
+  Recipe* bruschetta = createRecipeFromData("Bruschetta", 15, MealType::Snack, DietType::Vegan);
+  bruschetta->addIngredient(Ingredient("tomato", "2"));
+  bruschetta->addIngredient(Ingredient("basil", "5g"));
+  recipes.push_back(caprese);
+  recipes.push_back(bruschetta);
+
+  RecipeStore store;
+  store.addAll(recipes);
+  IngredientIndex index;
+  store.addListener(&index); // Built from the recipes already in the store
+
+  assert(index.lookup("tomato").size() == 2);
+  assert(index.query("tomato AND basil").size() == 2);
+  PostingList result = index.query("tomato AND basil AND NOT cheese");
+  assert(result.size() == 1 && result[0] == bruschetta->getId());
+  assert(index.query("NOT tomato").empty());
+  assert(index.query("saffron").empty());
+
+  // Incremental maintenance through Recipe's ingredient methods
+  bruschetta->addIngredient(Ingredient("garlic", "1clove"));
+  assert(index.lookup("garlic").size() == 1);
+  caprese->removeIngredient("cheese");
+  assert(index.query("tomato AND NOT cheese").size() == 2);
+  caprese->editIngredient("basil", Ingredient("oregano", "1tsp"));
+  assert(index.lookup("basil").size() == 1);
+  assert(index.lookup("oregano").size() == 1);
+
+  Recipe* salsa = createRecipeFromData("Salsa", 5, MealType::Snack, DietType::Vegan);
+  salsa->addIngredient(Ingredient("tomato", "3"));
+  recipes.push_back(salsa);
+  store.add(salsa);
+  assert(index.lookup("tomato").size() == 3);
+
+  // Galloping intersection agrees with a plain merge on skewed lists
+  PostingList big, small;
+  for (int i = 0; i < 1000; ++i) big.push_back(i * 3);
+  small.push_back(3); small.push_back(4); small.push_back(2997); small.push_back(5000);
+  PostingList both = intersectPostings(small, big);
+  assert(both.size() == 2 && both[0] == 3 && both[1] == 2997);
+  assert(subtractPostings(small, big).size() == 2);
+
+  // Cleanup
+  recipes.clear();
+  assert(index.recipeCount() == 0);
+  assert(index.lookup("tomato").empty());
+}
+
+
+void testBinaryCatalog() {
+  std::cout << "Testing BinaryCatalog...\n";
+  const std::string binFile = "test_catalog.bin";
+  const std::string textFile = "test_catalog.txt";
+
+  LinkedList<Recipe*> recipes;
+  Recipe* soup = createRecipeFromData("Lentil Soup", 40, MealType::Dinner, DietType::Vegan);
+  soup->addIngredient(Ingredient("lentils", "150g"));
+  soup->addIngredient(Ingredient("onion", "40g"));
+  Recipe* omelette = createRecipeFromData("Omelette", 10, MealType::Breakfast, DietType::Vegetarian);
+  omelette->addIngredient(Ingredient("eggs", "3"));
+  omelette->addIngredient(Ingredient("onion", "20g"));
+  recipes.push_back(soup);
+  recipes.push_back(omelette);
+
+  BinaryCatalog::write(binFile, recipes);
+  assert(!std::ifstream((binFile + ".tmp").c_str())); // Renamed into place
+
+  {
+    BinaryCatalog catalog;
+    catalog.open(binFile);
+    assert(catalog.size() == 2);
+    assert(catalog.getTitle(0) == "Lentil Soup");
+    assert(catalog.getPrepTime(1) == 10);
+    assert(catalog.getMealType(1) == MealType::Breakfast);
+    assert(catalog.getDietType(0) == DietType::Vegan);
+    assert(catalog.getIngredientCount(0) == 2);
+    assert(catalog.getIngredientName(1, 0) == "eggs");
+    assert(catalog.getIngredientQuantity(1, 1) == "20g");
+    assert(catalog.findByIngredient("onion").size() == 2);
+    assert(catalog.findByIngredient("eggs").size() == 1);
+    assert(catalog.findByIngredient("ONION").size() == 2 && catalog.findByIngredient("Eggs").size() == 1);
+
+    Recipe* copy = catalog.materialize(1);
+    assert(copy->getTypeString() == "Vegetarian");
+    assert(copy->serialize() == omelette->serialize());
+    delete copy;
+  }
+
+  // Round trip through both converters
+  assert(RecipeManager::convertBinaryToText(binFile, textFile) == 2);
+  assert(RecipeManager::convertTextToBinary(textFile, binFile) == 2);
+  LinkedList<Recipe*> reloaded = RecipeManager::loadFromBinaryFile(binFile);
+  assert(reloaded.size() == 2);
+  assert((*reloaded.begin())->serialize() == soup->serialize());
+
+  // Without the body checksum, corrupt record fields are caught when read
+  // (records start right after the 64-byte header)
+  {
+    std::fstream file(binFile.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    const std::uint32_t huge = 0x7FFFFFFF;
+    file.seekp(64 + 4); // Record 0: titleLength
+    file.write(reinterpret_cast<const char*>(&huge), sizeof(huge));
+    file.seekp(64 + 24 + 16); // Record 1: firstIngredient
+    file.write(reinterpret_cast<const char*>(&huge), sizeof(huge));
+  }
+  {
+    BinaryCatalog catalog;
+    catalog.open(binFile, false);
+    int caught = 0;
+    try { catalog.getTitle(0); } catch (const std::runtime_error&) { ++caught; }
+    try { catalog.getIngredientName(1, 0); } catch (const std::runtime_error&) { ++caught; }
+    try { catalog.findByIngredient("eggs"); } catch (const std::runtime_error&) { ++caught; }
+    try { delete catalog.materialize(1); } catch (const std::runtime_error&) { ++caught; }
+    assert(caught == 4);
+    assert(catalog.getIngredientName(0, 0) == "lentils"); // Intact records still read
+  }
+
+  // A flipped byte or a truncated file is rejected
+  {
+    std::fstream file(binFile.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(-3, std::ios::end);
+    file.put('X');
+  }
+  bool rejected = false;
+  try {
+    BinaryCatalog catalog;
+    catalog.open(binFile);
+  } catch (const std::runtime_error&) {
+    rejected = true;
+  }
+  assert(rejected);
+
+  {
+    std::ofstream truncated(binFile.c_str(), std::ios::binary | std::ios::trunc);
+    truncated << "RCPB";
+  }
+  rejected = false;
+  try {
+    BinaryCatalog catalog;
+    catalog.open(binFile);
+  } catch (const std::runtime_error&) {
+    rejected = true;
+  }
+  assert(rejected);
+
+  // Cleanup
+  std::remove(binFile.c_str());
+  std::remove(textFile.c_str());
+  recipes.clear();
+  reloaded.clear();
+}
+
+
+void testRecipeParser() {
+  std::cout << "Testing RecipeParser...\n";
+  const std::string text =
+      "Vegan|Tofu Scramble|15|Breakfast|Vegan|tofu:200g;spinach:50g\r\n"
+      "\n"
+      "Pescatarian|Fish Tacos|20|Dinner|Other|fish:100g\n"
+      "Omnivore|Steak|abc|Dinner|Omnivore|beef:300g\n"
+      "Vegan|Honey Toast|5|Snack|Vegan|bread:1slice;honey:1tbsp\n"
+      "Vegetarian|Caprese Salad|10|Lunch|Vegetarian|tomato:100g;basil:10g";
+
+  LinkedList<Recipe*> recipes;
+  std::vector<ParseError> errors;
+  RecipeParser::parseBuffer(text.data(), text.size(), 1, recipes, errors);
+
+  assert(recipes.size() == 2);
+  assert((*recipes.begin())->getTitle() == "Tofu Scramble");
+  assert((*recipes.begin())->getIngredients().size() == 2);
+
+  assert(errors.size() == 3);
+  assert(errors[0].line() == 3 && errors[0].column() == 1);  // Unknown type
+  assert(errors[1].line() == 4 && errors[1].column() == 16); // Bad prep time
+  assert(errors[2].line() == 5 && errors[2].column() == 46); // Non-vegan ingredient
+
+  // deserialize() shares the parser and round-trips serialize()
+  Recipe* caprese = *(++recipes.begin());
+  Recipe* copy = Recipe::deserialize(caprese->serialize());
+  assert(copy->serialize() == caprese->serialize());
+  delete copy;
+
+  // Lines that straddle read blocks are stitched back together
+  const std::string fileName = "test_parser.txt";
+  const int LINES = 30000; // ~2 MB, spans several 1 MB blocks
+  {
+    std::ofstream out(fileName.c_str());
+    for (int i = 0; i < LINES; ++i) {
+      out << "Omnivore|Recipe " << i << "|" << i % 90 << "|Dinner|Omnivore|chicken:200g;rice:100g;garlic:1clove;onion:1\n";
+    }
+  }
+  LinkedList<Recipe*> loaded;
+  errors.clear();
+  assert(RecipeParser::parseFile(fileName, loaded, errors));
+  assert(errors.empty());
+  assert(loaded.size() == LINES);
+  int expected = 0;
+  for (LinkedList<Recipe*>::iterator it = loaded.begin(); it != loaded.end(); ++it, ++expected) {
+    assert((*it)->getPrepTime() == expected % 90);
+    assert((*it)->getIngredients().size() == 4);
+  }
+  assert(!RecipeParser::parseFile("missing_file.txt", loaded, errors));
+
+  // ParseCache hands back the same Ingredient the text would build and keeps
+  // each spelling; a cached pair still goes through the recipe's validation
+  ParseCache cache;
+  const char pairs[] = "garlic:1clove;Garlic:1clove;garlic:1clove";
+  Ingredient first = cache.ingredient(TextSpan(pairs, pairs + 6), TextSpan(pairs + 7, pairs + 13));
+  Ingredient capital = cache.ingredient(TextSpan(pairs + 14, pairs + 20), TextSpan(pairs + 21, pairs + 27));
+  Ingredient again = cache.ingredient(TextSpan(pairs + 28, pairs + 34), TextSpan(pairs + 35, pairs + 41));
+  assert(first == Ingredient("garlic", "1clove") && again == first);
+  assert(capital.getId() == first.getId() && capital.getName() == "Garlic");
+  assert(again.getParsedQuantity().unit == Ingredient("garlic", "1clove").getParsedQuantity().unit);
+  const std::string honey = "Vegan|Honey Oats|5|Breakfast|Vegan|oats:50g;honey:1tbsp";
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    bool threw = false;
+    try {
+      delete RecipeParser::parseLine(honey.data(), honey.data() + honey.size(), 1, cache);
+    } catch (const ParseError&) {
+      threw = true;
+    }
+    assert(threw);
+  }
+
+  // Cleanup
+  std::remove(fileName.c_str());
+  recipes.clear();
+  loaded.clear();
+}
+
+
+void testParallelLoading() {
+  std::cout << "Testing parallel loading...\n";
+  const std::string fileName = "test_parallel.txt";
+  const int LINES = 40000; // ~3 MB, above the parallel threshold
+  {
+    std::ofstream out(fileName.c_str());
+    for (int i = 1; i <= LINES; ++i) {
+      if (i % 9973 == 0) {
+        out << "Broken|line " << i << "|1|Lunch|Other|x:1\n";
+      } else if (i % 5000 == 0) {
+        out << "\n";
+      } else {
+        out << "Vegan|Recipe " << i << "|" << i % 60 << "|Lunch|Vegan|rice:100g;beans:80g;salsa:2tbsp\n";
+      }
+    }
+  }
+
+  LinkedList<Recipe*> sequential;
+  std::vector<ParseError> sequentialErrors;
+  RecipeParser::parseFile(fileName, sequential, sequentialErrors);
+
+  LinkedList<Recipe*> parallel;
+  std::vector<ParseError> parallelErrors;
+  assert(RecipeParser::parseFileParallel(fileName, parallel, parallelErrors, 4));
+
+  // Same recipes in the same order, same errors on the same lines
+  assert(parallel.size() == sequential.size());
+  assert(parallel.size() == LINES - 4 - 8);
+  LinkedList<Recipe*>::iterator a = sequential.begin();
+  for (LinkedList<Recipe*>::iterator b = parallel.begin(); b != parallel.end(); ++a, ++b) {
+    assert((*a)->getTitle() == (*b)->getTitle());
+  }
+  assert(parallelErrors.size() == 4 && sequentialErrors.size() == 4);
+  for (std::size_t i = 0; i < parallelErrors.size(); ++i) {
+    assert(parallelErrors[i].line() == static_cast<int>(9973 * (i + 1)));
+    assert(parallelErrors[i].line() == sequentialErrors[i].line());
+  }
+
+  LinkedList<Recipe*> managed = RecipeManager::loadFromFile(fileName, 0);
+  assert(managed.size() == parallel.size());
+  assert(!RecipeParser::parseFileParallel("missing_file.txt", parallel, parallelErrors, 4));
+
+  // Cleanup
+  std::remove(fileName.c_str());
+  sequential.clear();
+  parallel.clear();
+  managed.clear();
+}
+
+// Finds a recipe by title in a journal test session
+static Recipe* journalTestFind(LinkedList<Recipe*>& recipes, const std::string& title) {
+  for (LinkedList<Recipe*>::iterator it = recipes.begin(); it != recipes.end(); ++it) {
+    if ((*it)->getTitle() == title) return *it;
+  }
+  return nullptr;
+}
+
+// An AddRecipe record whose line no longer parses (e.g. a title with '|'
+// written by an older build) is skipped; the rest of the journal still applies
+static void testRecipeJournalUnparsableAdd() {
+  const std::string fileName = "test_journal_unparsable.txt";
+  const std::string journalFile = fileName + ".journal";
+  std::remove(journalFile.c_str());
+  {
+    std::ofstream out(fileName.c_str());
+    out << "Vegan|Salad|10|Lunch|Vegan|lettuce:1 head\n";
+  }
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 0);
+    Recipe* mac = new VeganRecipe("Mac X Cheese", 20, MealType::Dinner);
+    recipes.push_back(mac);
+    store.add(mac);
+    mac->setPrepTime(25);
+    journalTestFind(recipes, "Salad")->setPrepTime(12);
+    journal.sync();
+  }
+
+  // Turn the logged title into "Mac | Cheese" and re-seal the record
+  std::string bytes;
+  {
+    std::ifstream in(journalFile.c_str(), std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  std::size_t line = bytes.find("Vegan|Mac X Cheese|");
+  assert(line != std::string::npos);
+  bytes[line + 10] = '|';
+  std::size_t record = line - 4 - 4 - 1 - 4 - 4; // length, crc, op, journal id, string length
+  std::uint32_t length;
+  std::memcpy(&length, &bytes[record], sizeof(length));
+  std::uint32_t checksum = crc32(&bytes[record + 8], length + 1);
+  std::memcpy(&bytes[record + 4], &checksum, sizeof(checksum));
+  {
+    std::ofstream out(journalFile.c_str(), std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  }
+
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 1); // Only the Salad edit applies
+    journal.waitForCompaction();
+    assert(recipes.size() == 1 && store.size() == 1);
+    assert(journalTestFind(recipes, "Salad")->getPrepTime() == 12);
+  }
+  // The compacted snapshot loads cleanly
+  LinkedList<Recipe*> reloaded = RecipeManager::loadFromFile(fileName);
+  assert(reloaded.size() == 1);
+  reloaded.clear();
+
+  std::remove(fileName.c_str());
+  std::remove(journalFile.c_str());
+}
+
+void testRecipeJournal() {
+  std::cout << "Testing recipe journal...\n";
+  const std::string fileName = "test_journal.txt";
+  const std::string journalFile = fileName + ".journal";
+  std::remove(journalFile.c_str());
+  std::remove((journalFile + ".old").c_str());
+  std::remove((journalFile + ".rejected").c_str());
+  {
+    std::ofstream out(fileName.c_str());
+    out << "Vegan|Salad|10|Lunch|Vegan|lettuce:1 head\n";
+    out << "Omnivore|Stew|90|Dinner|Omnivore|beef:500g\n";
+    out << "Vegetarian|Omelette|5|Breakfast|Vegetarian|eggs:2\n";
+  }
+
+  // Session 1: log changes without ever rewriting the snapshot
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 0);
+
+    Recipe* soup = new VeganRecipe("Soup", 30, MealType::Dinner);
+    recipes.push_back(soup);
+    store.add(soup);
+    soup->addIngredient(Ingredient("carrot", "2"));
+    journalTestFind(recipes, "Salad")->setPrepTime(12);
+    journalTestFind(recipes, "Stew")->setTitle("Beef Stew");
+    journalTestFind(recipes, "Beef Stew")->editIngredient("beef", Ingredient("beef", "750g"));
+    recipes.removeIf([](Recipe* recipe) {
+      if (recipe->getTitle() != "Omelette") return false;
+      delete recipe;
+      return true;
+    });
+    journal.sync();
+    assert(journal.journalBytes() > 0);
+  }
+
+  // Session 2: replay over the untouched snapshot, then keep appending
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    assert(recipes.size() == 3); // Snapshot unchanged
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 6);
+    assert(recipes.size() == 3 && store.size() == 3);
+    assert(journalTestFind(recipes, "Salad")->getPrepTime() == 12);
+    assert(journalTestFind(recipes, "Omelette") == nullptr);
+    Recipe* stew = journalTestFind(recipes, "Beef Stew");
+    assert(stew && stew->getIngredients().begin()->getQuantity() == "750g");
+    Recipe* soup = journalTestFind(recipes, "Soup");
+    assert(soup && soup->getIngredients().size() == 1);
+    assert(journal.journalRecords() == 6); // Kept appending to the same journal
+    soup->setPrepTime(25);
+    assert(journal.journalRecords() == 7);
+  }
+
+  // A torn tail (crash mid-append) is dropped and triggers a compaction
+  {
+    std::ofstream torn(journalFile.c_str(), std::ios::binary | std::ios::app);
+    torn << "\x30\x00\x00\x00garbage";
+  }
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 7);
+    journal.waitForCompaction();
+    assert(journalTestFind(recipes, "Soup")->getPrepTime() == 25);
+  }
+  assert(!std::ifstream((journalFile + ".old").c_str()));
+
+  // Session 4: the compacted snapshot holds everything; ids map through the header
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    assert(recipes.size() == 3);
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 0);
+    assert(journal.journalRecords() == 0); // Nothing for exit to fold in
+    journalTestFind(recipes, "Soup")->addIngredient(Ingredient("onion", "1"));
+  }
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 1);
+    assert(journalTestFind(recipes, "Soup")->getIngredients().size() == 2);
+  }
+
+  // If the load comes up short (a snapshot line that no longer parses), base
+  // ids would shift onto the wrong recipes: the journal is set aside instead
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    recipes.removeIf([](Recipe* recipe) {
+      if (recipe->getTitle() != "Beef Stew") return false;
+      delete recipe;
+      return true;
+    });
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 0);
+    journal.waitForCompaction();
+    Recipe* soup = journalTestFind(recipes, "Soup");
+    assert(soup && soup->getIngredients().size() == 1); // The onion record was not replayed
+  }
+  assert(std::ifstream((journalFile + ".rejected").c_str()));
+  std::remove((journalFile + ".rejected").c_str());
+
+  // A journal written against a different snapshot is set aside, not replayed
+  {
+    std::ofstream out(fileName.c_str());
+    out << "Vegan|Toast|3|Breakfast|Vegan|bread:2 slices\n";
+  }
+  {
+    LinkedList<Recipe*> recipes = RecipeManager::loadFromFile(fileName);
+    RecipeStore store;
+    store.addAll(recipes);
+    RecipeJournal journal(fileName, 1);
+    assert(journal.open(recipes, store) == 0);
+    assert(recipes.size() == 1);
+  }
+  assert(std::ifstream((journalFile + ".rejected").c_str()));
+
+  // Cleanup
+  std::remove(fileName.c_str());
+  std::remove(journalFile.c_str());
+  std::remove((journalFile + ".rejected").c_str());
+
+  // Titles and ingredient text that would not survive the snapshot format are refused
+  bool rejected = false;
+  try { VeganRecipe("Mac | Cheese", 20, MealType::Dinner); } catch (const std::invalid_argument&) { rejected = true; }
+  assert(rejected);
+  rejected = false;
+  try { Ingredient("salt;pepper", "1 pinch"); } catch (const std::invalid_argument&) { rejected = true; }
+  assert(rejected);
+  assert(!Recipe::isValidTitle("Line\nBreak") && Recipe::isValidTitle("Mac & Cheese"));
+
+  testRecipeJournalUnparsableAdd();
+}
+
+void testSnapshotWriter() {
+  std::cout << "Testing SnapshotWriter...\n";
+  const std::string fileName = "test_snapshot.txt";
+  LinkedList<Recipe*> recipes;
+  RecipeStore store;
+  SnapshotCache cache;
+  store.addListener(&cache);
+  for (int i = 0; i < 3; ++i) {
+    Recipe* recipe = new VeganRecipe("Dish " + std::to_string(i), 10 + i, MealType::Lunch);
+    recipe->addIngredient(Ingredient("rice", "100g"));
+    recipes.push_back(recipe);
+    store.add(recipe);
+  }
+
+  // Synchronous write round-trips through the loader
+  SnapshotWriter::write(fileName, recipes);
+  LinkedList<Recipe*> loaded = RecipeManager::loadFromFile(fileName);
+  assert(loaded.size() == 3);
+  assert((*loaded.begin())->serialize() == (*recipes.begin())->serialize());
+  loaded.clear();
+
+  // Views are copy-on-write: later edits do not reach an earlier capture,
+  // and unchanged recipes share their serialized line
+  SnapshotView before = cache.capture(recipes);
+  (*recipes.begin())->setPrepTime(99);
+  SnapshotView after = cache.capture(recipes);
+  assert(before.lines.size() == 3 && after.lines.size() == 3);
+  assert(before.lines[0]->find("|10|") != std::string::npos);
+  assert(after.lines[0]->find("|99|") != std::string::npos);
+  assert(before.lines[1] == after.lines[1]);
+
+  // Background write of the earlier view, while the list keeps changing
+  SnapshotWriter writer;
+  writer.writeAsync(fileName, before);
+  (*recipes.begin())->setPrepTime(5);
+  writer.wait();
+  {
+    std::ifstream in(fileName.c_str());
+    std::string first;
+    std::getline(in, first);
+    assert(first == *before.lines[0]);
+  }
+  assert(before.checksum() != after.checksum());
+
+  // A failed write throws and leaves the previous snapshot in place
+  bool threw = false;
+  try {
+    SnapshotWriter::write("missing_dir/snapshot.txt", recipes);
+  } catch (const std::runtime_error&) {
+    threw = true;
+  }
+  assert(threw);
+  LinkedList<Recipe*> reloaded = RecipeManager::loadFromFile(fileName);
+  assert(reloaded.size() == 3);
+
+  // Cleanup
+  std::remove(fileName.c_str());
+  reloaded.clear();
+  store.removeListener(&cache);
+}
+
+void testIngredientPool() {
+  std::cout << "Testing IngredientPool...\n";
+  IngredientPool& pool = IngredientPool::instance();
+
+  // Spellings equal up to case share an id; each keeps its own text
+  Ingredient lower("olive oil", "1tbsp");
+  Ingredient upper("Olive Oil", "1tbsp");
+  assert(lower.getId() == upper.getId());
+  assert(lower == upper);
+  assert(upper.getName() == "Olive Oil" && lower.getName() == "olive oil");
+  assert(pool.folded(upper.getId()) == "olive oil");
+  assert(pool.find("OLIVE OIL") == lower.getId());
+  assert(pool.find("never interned here") == INVALID_INGREDIENT_ID);
+  assert(Ingredient("saffron", "1g").getId() != lower.getId());
+
+  // Quantity texts are interned exactly as written (not folded)
+  std::size_t quantities = pool.quantityCount();
+  Ingredient pinch("salt", "1 Pinch");
+  assert(Ingredient("pepper", "1 Pinch").getQuantity() == "1 Pinch" && pool.quantityCount() == quantities + 1);
+  assert(!(pinch == Ingredient("salt", "1 pinch")) && pinch.getParsedQuantity().unit == Unit::Pinch);
+
+  // Recipe lookups and duplicate checks go through the ids
+  Recipe* pasta = createRecipeFromData("Pasta", 20, MealType::Dinner, DietType::Vegan);
+  pasta->addIngredient(Ingredient("Garlic", "2cloves"));
+  assert(pasta->matchesIngredient("garlic"));
+  assert(pasta->matchesIngredient(Ingredient("GARLIC").getId()));
+  bool threw = false;
+  try {
+    pasta->addIngredient(Ingredient("garlic", "1clove"));
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+  assert(!pasta->validateIngredient(Ingredient("Cheese", "50g"))); // Diet check by id
+  pasta->editIngredient("GARLIC", Ingredient("garlic", "3cloves"));
+  assert(pasta->getIngredients().begin()->getQuantity() == "3cloves");
+  assert(pasta->serialize().find("garlic:3cloves") != std::string::npos);
+  pasta->addIngredient(Ingredient("Basil", "10g"));
+  threw = false;
+  try {
+    pasta->editIngredient("basil", Ingredient("GARLIC", "1clove")); // Renamed onto an existing one
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+  assert(pasta->getIngredients().size() == 2 && pasta->matchesIngredient("basil"));
+  pasta->removeIngredient("basil");
+
+  // Index lookups ignore case as well
+  LinkedList<Recipe*> recipes;
+  recipes.push_back(pasta);
+  RecipeStore store;
+  store.addAll(recipes);
+  IngredientIndex index;
+  store.addListener(&index);
+  assert(index.lookup("Garlic").size() == 1);
+  assert(index.query("GARLIC AND NOT cheese").size() == 1);
+  pasta->removeIngredient("Garlic");
+  assert(index.lookup("garlic").empty() && index.termCount() == 0);
+
+  // Repeated long names are stored once
+  for (int i = 0; i < 200; ++i) {
+    Recipe* recipe = createRecipeFromData("Dish " + std::to_string(i), 10, MealType::Lunch, DietType::Vegan);
+    recipe->addIngredient(Ingredient("extra virgin olive oil", "1tbsp"));
+    recipe->addIngredient(Ingredient("freshly ground black pepper", "1pinch"));
+    recipes.push_back(recipe);
+  }
+  InternStats stats = RecipeManager::internStats(recipes);
+  assert(stats.references == 400);
+  assert(stats.stringBytes >= 400 * sizeof(std::string));
+  assert(stats.internedBytes > 0);
+
+  // Cleanup
+  recipes.clear();
+}
+
+void testQuantity() {
+  std::cout << "Testing Quantity...\n";
+
+  // Numbers, fractions and units with or without spaces
+  Quantity grams = Quantity::parse("200g");
+  assert(grams.unit == Unit::Gram && grams.amount == 200.0f && grams.base == 200000);
+  Quantity spoon = Quantity::parse("1 tbsp ");
+  assert(spoon.unit == Unit::Tablespoon && spoon.kind() == UnitKind::Volume);
+  assert(spoon.base == 14787); // Microlitres
+  assert(Quantity::parse("1/2 cup").amount == 0.5f);
+  assert(Quantity::parse("1 1/2 tsp").amount == 1.5f);
+  assert(Quantity::parse("1.5kg").base == 1500000);
+  Quantity slices = Quantity::parse("2slices");
+  assert(slices.unit == Unit::Slice && slices.base == 2000);
+  assert(Quantity::parse("3").unit == Unit::Piece);
+  assert(Quantity::parse("pinch").unit == Unit::Pinch && Quantity::parse("pinch").amount == 1.0f);
+  assert(!Quantity::parse("to taste").isKnown() && Quantity::parse("to taste").base == 0);
+  assert(!Quantity::parse("").isKnown());
+  assert(unitToString(Unit::Tablespoon) == "tbsp");
+
+  // Parsed once with the ingredient; the text still round-trips
+  Ingredient flour("flour", "1 1/2 cups");
+  assert(flour.getParsedQuantity().unit == Unit::Cup);
+  assert(flour.toString() == "1 1/2 cups flour");
+  flour.setQuantity("500g");
+  assert(flour.getParsedQuantity().base == 500000);
+
+  // Totals across recipes convert to base units per kind
+  LinkedList<Recipe*> recipes;
+  const char* amounts[] = { "200g", "1/2 kg", "2 tbsp", "3cloves", "1slice", "to taste" };
+  for (int i = 0; i < 6; ++i) {
+    Recipe* recipe = createRecipeFromData("Dish " + std::to_string(i), 10, MealType::Dinner, DietType::Vegan);
+    recipe->addIngredient(Ingredient("garlic", amounts[i]));
+    recipe->addIngredient(Ingredient("salt", "1 pinch"));
+    recipes.push_back(recipe);
+  }
+  RecipeStore store;
+  store.addAll(recipes);
+  std::vector<RecipeId> ids;
+  for (RecipeId id = 0; id < store.idLimit(); ++id) ids.push_back(id);
+  ids.push_back(99); // Unknown ids are ignored
+
+  QuantityTotals garlic = store.sumIngredient(ids, IngredientPool::instance().find("Garlic"));
+  assert(garlic.milligrams == 700000 && garlic.grams() == 700.0);
+  assert(garlic.microliters == 2 * 14787);
+  assert(garlic.countUnit == Unit::Clove && garlic.milliCount == 3000);
+  assert(garlic.summed == 5 && garlic.skipped == 1); // "to taste" has no unit
+  assert(garlic.otherCounts.size() == 1 && garlic.otherCounts[0].first == Unit::Slice); // A slice is not a clove
+  assert(garlic.unmeasured.size() == 1 && garlic.unmeasured[0].first == "to taste");
+  assert(garlic.toString() == "700 g + 29.574 ml + 3 clove + 1 slice + to taste");
+  assert(store.sumIngredient(ids, IngredientPool::instance().find("salt")).summed == 6);
+  assert(store.sumIngredient(ids, IngredientPool::instance().find("no such thing")).summed == 0);
+
+  // Columns longer than one vector still sum exactly
+  QuantityColumns columns;
+  for (int i = 0; i < 1003; ++i) {
+    columns.push(Quantity::parse(i % 2 ? "1g" : "1ml"));
+  }
+  QuantityTotals totals = columns.sum();
+  assert(totals.milligrams == 501000 && totals.microliters == 502000 && totals.summed == 1003);
+
+  // Cleanup
+  recipes.clear();
+}
+
+void testGroceryList() {
+  std::cout << "Testing GroceryList...\n";
+  LinkedList<Recipe*> recipes;
+  Recipe* pasta = createRecipeFromData("Pasta", 20, MealType::Dinner, DietType::Vegan);
+  pasta->addIngredient(Ingredient("Garlic", "2cloves"));
+  pasta->addIngredient(Ingredient("olive oil", "1tbsp"));
+  pasta->addIngredient(Ingredient("spaghetti", "200g"));
+  Recipe* soup = createRecipeFromData("Soup", 30, MealType::Lunch, DietType::Vegan);
+  soup->addIngredient(Ingredient("garlic", "1clove"));
+  soup->addIngredient(Ingredient("Olive Oil", "30ml"));
+  soup->addIngredient(Ingredient("salt", "to taste"));
+  recipes.push_back(pasta);
+  recipes.push_back(soup);
+  RecipeStore store;
+  store.addAll(recipes);
+
+  // Ingredients merge by id across spellings; units are normalized
+  GroceryListBuilder builder(store);
+  MealPlan plan;
+  plan.push_back(pasta->getId());
+  plan.push_back(soup->getId());
+  plan.push_back(pasta->getId()); // Cooked twice
+  plan.push_back(42);             // Unknown ids are ignored
+  GroceryList list = builder.build(plan);
+  assert(list.size() == 4);
+  assert(list[0].getName() == "garlic" && list[0].total.milliCount == 5000);
+  assert(list[0].toString() == "garlic: 5 clove");
+  assert(list[1].getName() == "olive oil" && list[1].total.microliters == 2 * 14787 + 30000);
+  assert(list[2].getName() == "salt" && list[2].toString() == "salt: to taste");
+  assert(list[3].total.grams() == 400.0);
+  assert(builder.build(MealPlan()).empty());
+
+  // Count units that do not add up, and unparsed amounts, are kept as well
+  Recipe* stew = createRecipeFromData("Stew", 60, MealType::Dinner, DietType::Vegetarian);
+  stew->addIngredient(Ingredient("garlic", "1 head"));
+  stew->addIngredient(Ingredient("eggs", "2"));
+  stew->addIngredient(Ingredient("bay leaf", ""));
+  Recipe* cake = createRecipeFromData("Cake", 45, MealType::Dessert, DietType::Vegetarian);
+  cake->addIngredient(Ingredient("eggs", "a dozen"));
+  recipes.push_back(stew);
+  recipes.push_back(cake);
+  store.add(stew);
+  store.add(cake);
+  MealPlan mixed;
+  mixed.push_back(pasta->getId());
+  mixed.push_back(stew->getId());
+  mixed.push_back(cake->getId());
+  mixed.push_back(cake->getId());
+  GroceryList merged = builder.build(mixed);
+  assert(merged.size() == 5);
+  assert(merged[0].toString() == "bay leaf: as needed"); // No quantity given
+  assert(merged[1].toString() == "eggs: 2 + a dozen (x2)");
+  assert(merged[2].toString() == "garlic: 2 clove + 1 head");
+  assert(merged[2].total.summed == 2 && merged[2].total.skipped == 0);
+  assert(merged[1].total.summed == 1 && merged[1].total.skipped == 2);
+
+  // The threaded batch matches the sequential one, in plan order
+  std::vector<MealPlan> plans;
+  for (int i = 0; i < 50; ++i) {
+    MealPlan p(static_cast<std::size_t>(i % 5), pasta->getId());
+    p.push_back(soup->getId());
+    plans.push_back(p);
+  }
+  ThreadPool pool(4);
+  std::vector<GroceryList> sequential = builder.buildAll(plans);
+  std::vector<GroceryList> parallel = builder.buildAll(plans, &pool);
+  assert(sequential.size() == 50 && parallel.size() == 50);
+  for (std::size_t i = 0; i < plans.size(); ++i) {
+    assert(parallel[i].size() == sequential[i].size());
+    for (std::size_t j = 0; j < parallel[i].size(); ++j) {
+      assert(parallel[i][j].toString() == sequential[i][j].toString());
+    }
+  }
+  assert(parallel[7].size() == 4 && parallel[7][3].total.grams() == 400.0); // 2 pastas
+  assert(parallel[5].size() == 3); // Soup only
+
+  // Cleanup
+  recipes.clear();
+}
+
+void testScaledRecipe() {
+  std::cout << "Testing ScaledRecipe...\n";
+  Recipe* soup = createRecipeFromData("Soup", 30, MealType::Lunch, DietType::Vegan);
+  soup->addIngredient(Ingredient("lentils", "200g"));
+  soup->addIngredient(Ingredient("stock", "1 1/2 cups"));
+  soup->addIngredient(Ingredient("garlic", "3"));
+  soup->addIngredient(Ingredient("cumin", "pinch"));
+  soup->addIngredient(Ingredient("salt", "to taste"));
+  const std::string original = soup->serialize();
+
+  // Text keeps its wording; only the number changes
+  ScaledRecipe doubled(*soup, ScaledRecipe::servingFactor(2, 4));
+  assert(doubled.getFactor() == 2.0);
+  assert(doubled.serialize() == "Vegan|Soup|30|Lunch|Vegan|lentils:400g;stock:3 cups;garlic:6;cumin:2 pinch;salt:to taste");
+  IngredientList::const_iterator lentils = soup->getIngredients().begin();
+  assert(doubled.getQuantity(*lentils).base == 400000 && doubled.getQuantity(*lentils).unit == Unit::Gram);
+  ScaledRecipe third(*soup, 1.0 / 3.0);
+  assert(third.getQuantityText(*lentils) == "66.67g");
+  assert(ScaledRecipe(*soup, 1.0).serialize() == original);
+
+  // The recipe itself is untouched
+  assert(soup->serialize() == original);
+  bool threw = false;
+  try {
+    ScaledRecipe invalid(*soup, 0.0);
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+
+  // Batch export re-parses into the scaled recipes
+  LinkedList<Recipe*> recipes;
+  recipes.push_back(soup);
+  const std::string fileName = "test_scaled.txt";
+  SnapshotWriter::writeScaled(fileName, recipes, 2.0);
+  LinkedList<Recipe*> loaded = RecipeManager::loadFromFile(fileName);
+  assert(loaded.size() == 1);
+  assert((*loaded.begin())->serialize() == doubled.serialize());
+  std::remove(fileName.c_str());
+
+  // Cleanup
+  recipes.clear();
+  loaded.clear();
+}
+
+void testTitleIndex() {
+  std::cout << "Testing TitleIndex...\n";
+  LinkedList<Recipe*> recipes;
+  recipes.push_back(createRecipeFromData("Tomato Soup", 30, MealType::Lunch, DietType::Vegan));
+  recipes.push_back(createRecipeFromData("Tofu Scramble", 15, MealType::Breakfast, DietType::Vegan));
+  recipes.push_back(createRecipeFromData("Roast Tomatoes", 40, MealType::Dinner, DietType::Vegan));
+  recipes.push_back(createRecipeFromData("tomato salad", 10, MealType::Lunch, DietType::Vegan));
+  RecipeStore store;
+  store.addAll(recipes);
+  TitleIndex index;
+  store.addListener(&index);
+  assert(index.size() == 4);
+
+  // Prefix search ignores case and returns title order
+  std::vector<RecipeId> prefix = index.findPrefix("TOMATO");
+  assert(prefix.size() == 2 && prefix[0] == 3 && prefix[1] == 0); // "tomato salad" < "tomato soup"
+  assert(index.findPrefix("to", 1).size() == 1);
+  assert(index.findPrefix("t").size() == 3);
+  assert(index.findPrefix("").size() == 4);
+  assert(index.findPrefix("zucchini").empty());
+
+  // Substring search: short queries use one gram, long ones are verified
+  assert(index.findSubstring("tomato").size() == 3);
+  assert(index.findSubstring("o").size() == 4);
+  assert(index.findSubstring("st T").size() == 1);
+  assert(index.findSubstring("soup").size() == 1 && index.findSubstring("soup")[0] == 0);
+  assert(index.findSubstring("tomato tomato").empty());
+  assert(index.findSubstring("mble").size() == 1);
+  assert(index.findSubstring("xyz").empty());
+  assert(index.findSubstring("").size() == 4);
+
+  // Renames and removals are applied incrementally
+  Recipe* tofu = store.get(1);
+  tofu->setTitle("Tomato Tofu Scramble");
+  assert(index.findPrefix("tomato").size() == 3);
+  assert(index.findPrefix("tofu").empty());
+  assert(index.findSubstring("tofu").size() == 1);
+  store.remove(0);
+  assert(index.findSubstring("soup").empty());
+  assert(index.size() == 3);
+  Recipe* pie = createRecipeFromData("Tomato Pie", 50, MealType::Dinner, DietType::Vegan);
+  recipes.push_back(pie);
+  store.add(pie);
+  assert(index.findPrefix("tomato p").size() == 1 && index.findPrefix("tomato p")[0] == pie->getId());
+
+  // Adds wait for the next prefix lookup; renames and removals in between still land
+  Recipe* tart = createRecipeFromData("Apple Tart", 45, MealType::Dinner, DietType::Vegan);
+  Recipe* bake = createRecipeFromData("Zucchini Bake", 35, MealType::Dinner, DietType::Vegan);
+  recipes.push_back(tart);
+  store.add(tart);
+  recipes.push_back(bake);
+  store.add(bake);
+  tart->setTitle("Banana Tart");
+  store.remove(bake->getId());
+  std::vector<RecipeId> all = index.findPrefix("");
+  assert(all.size() == 5 && all[0] == tart->getId() && all[1] == 2); // "banana tart" < "roast tomatoes"
+  assert(index.findPrefix("zucchini").empty() && index.findPrefix("apple").empty());
+
+  // Cleanup
+  recipes.clear();
+  assert(index.size() == 0 && index.gramCount() == 0);
+}
+
+void testFuzzySearch() {
+  std::cout << "Testing FuzzySearch...\n";
+
+  // Bounded Damerau distance
+  assert(damerauDistance("mozarella", "mozzarella", 2) == 1);
+  assert(damerauDistance("chikpea", "chickpea", 2) == 1);
+  assert(damerauDistance("tomtao", "tomato", 2) == 1); // Transposition
+  assert(damerauDistance("basil", "basil", 0) == 0);
+  assert(damerauDistance("kitten", "sitting", 2) == 3); // Capped at max + 1
+  assert(damerauDistance("a", "abcd", 1) == 2);
+
+  // The matcher's filters (trigrams, lengths, bytes present) never drop a
+  // term within the distance, including 6-byte queries at distance 2
+  FuzzyMatcher matcher;
+  const char* vocabulary[] = { "tomato", "tomatoes", "potato", "tomtato", "toma", "tamota", "motato",
+                               "tomatoeses", "soup", "mato", "atomot", "tomatoo", "t0mato", "xomatx" };
+  for (std::size_t i = 0; i < sizeof(vocabulary) / sizeof(vocabulary[0]); ++i) matcher.add(vocabulary[i]);
+  const char* typos[] = { "tomtao", "tmato", "tomatos", "pottao", "soupp", "mtoato" };
+  for (std::size_t q = 0; q < sizeof(typos) / sizeof(typos[0]); ++q) {
+    const std::string query = typos[q];
+    const int maxDistance = defaultMaxDistance(query.size());
+    std::vector<FuzzyMatcher::Match> found = matcher.find(query, maxDistance, 100);
+    std::size_t expected = 0;
+    for (std::uint32_t id = 0; id < matcher.size(); ++id) {
+      if (damerauDistance(query, matcher.term(id), maxDistance) <= maxDistance) expected++;
+    }
+    assert(found.size() == expected);
+  }
+  assert(matcher.find("tomtao", 2, 100).size() == 5); // tomato, tomtato, toma, tomatoo, t0mato
+  assert(matcher.find("tomtao", 2, 1)[0].term == 0 && matcher.find("tomtao", 2, 1)[0].distance == 1);
+
+  LinkedList<Recipe*> recipes;
+  Recipe* caprese = createRecipeFromData("Caprese Salad", 10, MealType::Lunch, DietType::Vegetarian);
+  caprese->addIngredient(Ingredient("mozzarella", "80g"));
+  caprese->addIngredient(Ingredient("tomato", "100g"));
+  Recipe* hummus = createRecipeFromData("Classic Hummus", 15, MealType::Other, DietType::Vegan);
+  hummus->addIngredient(Ingredient("chickpeas", "200g"));
+  Recipe* curry = createRecipeFromData("Chickpea Curry", 35, MealType::Dinner, DietType::Vegan);
+  curry->addIngredient(Ingredient("chickpea", "250g"));
+  curry->addIngredient(Ingredient("tomato", "200g"));
+  recipes.push_back(caprese);
+  recipes.push_back(hummus);
+  recipes.push_back(curry);
+  RecipeStore store;
+  store.addAll(recipes);
+  IngredientIndex ingredients;
+  store.addListener(&ingredients);
+  FuzzySearch fuzzy(ingredients);
+  store.addListener(&fuzzy);
+
+  // Ingredient typos rank exact-distance matches first
+  std::vector<FuzzyHit> hits = fuzzy.searchIngredients("mozarella");
+  assert(hits.size() == 1 && hits[0].id == caprese->getId() && hits[0].distance == 1);
+  hits = fuzzy.searchIngredients("chikpea");
+  assert(hits.size() == 2);
+  assert(hits[0].id == curry->getId() && hits[0].distance == 1);   // "chickpea"
+  assert(hits[1].id == hummus->getId() && hits[1].distance == 2);  // "chickpeas"
+  assert(fuzzy.searchIngredients("chikpea", 1).size() == 1);
+
+  // Title words: every word must match, distances add up
+  hits = fuzzy.searchTitles("chikpea cury");
+  assert(hits.size() == 1 && hits[0].id == curry->getId() && hits[0].distance == 2);
+  hits = fuzzy.searchTitles("CLASIC");
+  assert(hits.size() == 1 && hits[0].id == hummus->getId());
+  assert(fuzzy.searchTitles("pizza").empty());
+  assert(fuzzy.searchTitles("").empty());
+
+  // Combined search keeps each recipe's best match
+  hits = fuzzy.search("tomatoe");
+  assert(hits.size() == 2 && hits[0].id == caprese->getId() && hits[1].id == curry->getId());
+
+  // Renames and removals are picked up
+  curry->setTitle("Spicy Stew");
+  assert(fuzzy.searchTitles("cury").empty());
+  assert(fuzzy.searchTitles("spicey").size() == 1);
+  store.remove(caprese->getId());
+  assert(fuzzy.searchTitles("caprese").empty());
+
+  // Top-k tiers: many exact matches fill k before any typo match is read
+  LinkedList<Recipe*> many;
+  RecipeStore manyStore;
+  for (int i = 0; i < 100; ++i) {
+    many.push_back(createRecipeFromData(i % 2 ? "Lentil Soup" : "Lentils", 20, MealType::Lunch, DietType::Vegan));
+  }
+  manyStore.addAll(many);
+  IngredientIndex manyIngredients;
+  FuzzySearch manyFuzzy(manyIngredients);
+  manyStore.addListener(&manyFuzzy);
+  hits = manyFuzzy.searchTitles("lentil", 5);
+  assert(hits.size() == 5);
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    assert(hits[i].distance == 0 && hits[i].id == static_cast<RecipeId>(2 * i + 1));
+  }
+  assert(manyFuzzy.searchTitles("lentil", 60)[50].distance == 1); // "lentils" after all 50 exact
+
+  // Cleanup
+  recipes.clear();
+  many.clear();
+}
+
+void testBitmapIndex() {
+  std::cout << "Testing BitmapIndex...\n";
+
+  // Bitset basics across word boundaries and unequal lengths
+  Bitset a;
+  Bitset b;
+  a.set(3);
+  a.set(64);
+  a.set(200);
+  b.set(64);
+  b.set(65);
+  assert(a.count() == 3 && a.test(200) && !a.test(199));
+  assert((a & b).count() == 1 && Bitset::countAnd(a, b) == 1);
+  assert((a | b).count() == 4);
+  Bitset c = a;
+  c.andNot(b);
+  assert(c.toPostingList() == PostingList({ 3, 200 }));
+  assert(Bitset::fromPostingList(PostingList({ 5, 130 })).count() == 2);
+  assert(Bitset().none() && Bitset().toPostingList().empty());
+
+  LinkedList<Recipe*> recipes;
+  for (int i = 0; i < 150; ++i) {
+    MealType meal = (i % 3 == 0) ? MealType::Breakfast : MealType::Dinner;
+    DietType diet = (i % 2 == 0) ? DietType::Vegan : DietType::Omnivore;
+    recipes.push_back(createRecipeFromData("Dish " + std::to_string(i), i, meal, diet));
+  }
+  RecipeStore store;
+  store.addAll(recipes);
+  BitmapIndex index;
+  store.addListener(&index);
+  assert(index.size() == 150);
+
+  // Same answers as the column scans
+  assert(index.withMealType(MealType::Breakfast).toPostingList() == store.findByMealType(MealType::Breakfast));
+  assert(index.withDietType(DietType::Vegan).toPostingList() == store.findByDietType(DietType::Vegan));
+  assert(index.withMaxPrepTime(100).toPostingList() == store.findByMaxPrepTime(100));
+  assert(index.withMealType(MealType::Snack).none());
+
+  // Vegan AND Breakfast AND prepTime <= 15: ids 0, 6, 12
+  Bitset quick = index.filter(DietType::Vegan, MealType::Breakfast, 15);
+  assert(quick.toPostingList() == PostingList({ 0, 6, 12 }));
+  assert(index.filter(DietType::Vegan, MealType::Breakfast).count() == 25);
+
+  // Changes are applied incrementally
+  Recipe* dish6 = store.get(6);
+  dish6->setPrepTime(90);
+  dish6->setMealType(MealType::Snack);
+  dish6->setDietType(DietType::Vegetarian);
+  assert(index.filter(DietType::Vegan, MealType::Breakfast, 15).toPostingList() == PostingList({ 0, 12 }));
+  assert(index.withMealType(MealType::Snack).toPostingList() == PostingList({ 6 }));
+  assert(index.withDietType(DietType::Vegetarian).count() == 1);
+  store.remove(0);
+  assert(!index.all().test(0) && !index.withMealType(MealType::Breakfast).test(0));
+  assert(index.filter(DietType::Vegan, MealType::Breakfast, 15).toPostingList() == PostingList({ 12 }));
+
+  // Cleanup
+  recipes.clear();
+  assert(index.size() == 0);
+}
+
+void testQueryEngine() {
+  std::cout << "Testing QueryEngine...\n";
+
+  // Parsing
+  Query parsed = Query::parse("EXPLAIN diet:vegan meal:Dinner prep<=30 -ing:tofu title:\"green curry\" sort:prep limit:20");
+  assert(parsed.explain && parsed.predicates.size() == 5);
+  assert(parsed.predicates[0].kind == QueryPredicate::Diet && parsed.predicates[0].diet == DietType::Vegan);
+  assert(parsed.predicates[1].meal == MealType::Dinner);
+  assert(parsed.predicates[2].comparison == QueryPredicate::LessEqual && parsed.predicates[2].minutes == 30);
+  assert(parsed.predicates[3].negated && parsed.predicates[3].text == "tofu");
+  assert(parsed.predicates[4].kind == QueryPredicate::Title && parsed.predicates[4].text == "green curry");
+  assert(parsed.sortBy == Query::ByPrepTime && parsed.limit == 20);
+  const char* invalid[] = { "diet:paleo", "prep~30", "colour:red", "sort:rating", "limit:many", "title:\"open" };
+  for (std::size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+    bool threw = false;
+    try { Query::parse(invalid[i]); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+  }
+
+  LinkedList<Recipe*> recipes;
+  for (int i = 0; i < 200; ++i) {
+    MealType meal = (i % 3 == 0) ? MealType::Breakfast : MealType::Dinner;
+    DietType diet = (i % 2 == 0) ? DietType::Vegan : DietType::Omnivore;
+    std::string title = (i % 4 == 0) ? "Green Curry " : "Dish ";
+    Recipe* recipe = createRecipeFromData(title + std::to_string(i), 200 - i, meal, diet);
+    if (i % 5 == 0) recipe->addIngredient(Ingredient("spinach", "100g"));
+    if (i % 20 == 0) recipe->addIngredient(Ingredient("tofu", "200g"));
+    recipes.push_back(recipe);
+  }
+  RecipeStore store;
+  store.addAll(recipes);
+  IngredientIndex ingredients;
+  store.addListener(&ingredients);
+  TitleIndex titles;
+  store.addListener(&titles);
+  BitmapIndex bitmaps;
+  store.addListener(&bitmaps);
+  PrepTimeIndex prepTimes;
+  store.addListener(&prepTimes);
+  QueryEngine engine(store, ingredients, titles, bitmaps, prepTimes);
+
+  // Same answer as checking every recipe; the rarest predicate drives the plan
+  QueryResult result = engine.run("diet:vegan meal:dinner prep<150 ing:spinach -ing:tofu");
+  std::vector<RecipeId> expected;
+  for (int i = 0; i < 200; ++i) {
+    if (i % 2 == 0 && i % 3 != 0 && 200 - i < 150 && i % 5 == 0 && i % 20 != 0) expected.push_back(i);
+  }
+  assert(!expected.empty() && result.ids == expected);
+  assert(result.plan.size() == 5);
+  assert(result.plan[0].operation.find("ing = spinach") != std::string::npos && result.plan[0].actual == 40);
+  assert(result.plan.back().actual == expected.size());
+  std::string explain = result.explain();
+  assert(explain.find("Est. rows") != std::string::npos && explain.find("NOT ing = tofu") != std::string::npos);
+
+  // Negations alone scan every recipe
+  result = engine.run("-ing:spinach -title:curry");
+  assert(result.plan[0].actual == 200 && result.ids.size() == 120);
+
+  // Sorting with a limit, and a limit that stops the stream early
+  result = engine.run("diet:vegan sort:prep limit:3");
+  assert(result.ids == std::vector<RecipeId>({ 198, 196, 194 }));
+  result = engine.run("meal:dinner limit:4");
+  assert(result.ids == std::vector<RecipeId>({ 1, 2, 4, 5 }));
+  result = engine.run("title:\"green curry\" prep>=190 sort:title");
+  assert(result.ids == std::vector<RecipeId>({ 0, 4, 8 })); // "Green Curry 0" < "Green Curry 4" < "Green Curry 8"
+  result = engine.run("prep<5"); // Exact range count from the prep-time index
+  assert(result.plan[0].estimated == 4 && result.ids == std::vector<RecipeId>({ 196, 197, 198, 199 }));
+  assert(engine.run("ing:saffron meal:dinner").ids.empty());
+
+  // Cleanup
+  recipes.clear();
+}
+
+void testPrepTimeIndex() {
+  std::cout << "Testing PrepTimeIndex...\n";
+
+  LinkedList<Recipe*> recipes;
+  for (int i = 0; i < 100; ++i) {
+    recipes.push_back(createRecipeFromData("Dish " + std::to_string(i), 5 + (i * 37) % 60, MealType::Dinner, DietType::Vegan));
+  }
+  RecipeStore store;
+  store.addAll(recipes);
+  PrepTimeIndex index;
+  store.addListener(&index);
+  assert(index.size() == 100 && index.keyCount() == 60);
+
+  // Range scans agree with the column scan
+  assert(index.findRange(0, 20) == store.findByMaxPrepTime(20));
+  assert(index.findRange(0, 1000) == store.findByMaxPrepTime(1000));
+  assert(index.countRange(0, 20) == store.findByMaxPrepTime(20).size());
+  PostingList between = index.findRange(30, 40);
+  for (std::size_t i = 0; i < between.size(); ++i) {
+    assert(store.getPrepTime(between[i]) >= 30 && store.getPrepTime(between[i]) <= 40);
+  }
+  assert(!between.empty() && between.size() == index.countRange(30, 40));
+  assert(index.findRange(40, 30).empty() && index.countRange(0, 4) == 0);
+
+  // Fastest first, ties by id
+  std::vector<RecipeId> quickest = index.fastest(3, 1000);
+  assert(quickest.size() == 3);
+  assert(store.getPrepTime(quickest[0]) == 5 && store.getPrepTime(quickest[1]) == 5 && quickest[0] < quickest[1]);
+  assert(store.getPrepTime(quickest[2]) == 6);
+  assert(index.fastest(1000, 5).size() == 2);
+
+  // Histogram: 10-minute buckets from 0-9 to 60-69
+  std::vector<PrepTimeBucket> buckets = index.histogram(10);
+  assert(buckets.size() == 7 && buckets[0].minMinutes == 0 && buckets[6].maxMinutes == 69);
+  std::size_t counted = 0;
+  for (std::size_t i = 0; i < buckets.size(); ++i) counted += buckets[i].count;
+  assert(counted == 100 && buckets[0].count == index.countRange(0, 9));
+  bool threw = false;
+  try { index.histogram(0); } catch (const std::invalid_argument&) { threw = true; }
+  assert(threw);
+  {
+    // An outlier does not blow up the bucket count, and bounds near INT_MAX do not overflow
+    PrepTimeIndex outliers;
+    Recipe* quick = createRecipeFromData("Toast", 5, MealType::Breakfast, DietType::Vegan);
+    Recipe* slow = createRecipeFromData("Aged Miso", 2000000000, MealType::Other, DietType::Vegan);
+    Recipe* slowest = createRecipeFromData("Century Egg", std::numeric_limits<int>::max(), MealType::Other, DietType::Vegan);
+    RecipeStore outlierStore;
+    outlierStore.add(quick);
+    outlierStore.add(slow);
+    outlierStore.add(slowest);
+    outlierStore.addListener(&outliers);
+    std::vector<PrepTimeBucket> sparse = outliers.histogram(10);
+    assert(sparse.size() == 3 && sparse[0].minMinutes == 0 && sparse[0].count == 1);
+    assert(sparse[1].minMinutes == 2000000000 && sparse[1].maxMinutes == 2000000009);
+    assert(sparse[2].maxMinutes == std::numeric_limits<int>::max() && sparse[2].count == 1);
+    sparse = outliers.histogram(std::numeric_limits<int>::max());
+    assert(sparse.size() == 2 && sparse[0].count == 2 && sparse[1].minMinutes == std::numeric_limits<int>::max());
+    delete quick;
+    delete slow;
+    delete slowest;
+  }
+
+  // setPrepTime and removals keep it consistent
+  Recipe* first = store.get(quickest[0]);
+  first->setPrepTime(120);
+  assert(index.fastest(1, 1000)[0] == quickest[1]);
+  assert(index.findRange(100, 200) == PostingList({ quickest[0] }));
+  store.remove(quickest[1]);
+  assert(index.fastest(1, 1000)[0] == quickest[2] && index.size() == 99);
+  assert(index.findRange(0, 20) == store.findByMaxPrepTime(20));
+
+  // Cleanup
+  recipes.clear();
+  assert(index.size() == 0 && index.keyCount() == 0);
+}
+
+void testTopK() {
+  std::cout << "Testing topK...\n";
+
+  // Matches a stable full sort and leaves the list untouched
+  LinkedList<int> numbers;
+  for (int i = 0; i < 500; ++i) numbers.push_back((i * 7919) % 101);
+  std::vector<int> sorted;
+  for (LinkedList<int>::const_iterator it = numbers.cbegin(); it != numbers.cend(); ++it) sorted.push_back(*it);
+  std::vector<int> original = sorted;
+  std::stable_sort(sorted.begin(), sorted.end());
+  std::vector<int> smallest = numbers.topK(12, std::less<int>());
+  assert(smallest == std::vector<int>(sorted.begin(), sorted.begin() + 12));
+  assert(numbers.topK(1000, std::less<int>()) == sorted);
+  assert(numbers.topK(0, std::less<int>()).empty() && LinkedList<int>().topK(3, std::less<int>()).empty());
+  std::vector<int> after;
+  for (LinkedList<int>::const_iterator it = numbers.cbegin(); it != numbers.cend(); ++it) after.push_back(*it);
+  assert(after == original);
+
+  // Recipe comparators; equal prep times keep list order
+  LinkedList<Recipe*> recipes;
+  Recipe* slow = createRecipeFromData("Braise", 180, MealType::Dinner, DietType::Omnivore);
+  Recipe* toast = createRecipeFromData("Toast", 5, MealType::Breakfast, DietType::Vegan);
+  Recipe* salad = createRecipeFromData("Salad", 10, MealType::Lunch, DietType::Vegan);
+  Recipe* fruit = createRecipeFromData("Apple Slices", 5, MealType::Snack, DietType::Vegan);
+  recipes.push_back(slow);
+  recipes.push_back(toast);
+  recipes.push_back(salad);
+  recipes.push_back(fruit);
+  std::vector<Recipe*> quickest = recipes.topK(3, Recipe::compareByPrepTime);
+  assert(quickest.size() == 3 && quickest[0] == toast && quickest[1] == fruit && quickest[2] == salad);
+  std::vector<Recipe*> byTitle = recipes.topK(2, Recipe::compareByTitle);
+  assert(byTitle.size() == 2 && byTitle[0] == fruit && byTitle[1] == slow);
+  assert(*recipes.begin() == slow);
+
+  // Cleanup
+  recipes.clear();
+}
+
+void testSortedViews() {
+  std::cout << "Testing SortedViews...\n";
+
+  LinkedList<Recipe*> recipes;
+  for (int i = 0; i < 60; ++i) {
+    recipes.push_back(createRecipeFromData("Dish " + std::to_string((i * 17) % 60), 5 + (i * 13) % 40,
+                                           static_cast<MealType>(i % MEAL_TYPE_COUNT), DietType::Vegan));
+  }
+  RecipeStore store;
+  store.addAll(recipes);
+  SortedViews views;
+  store.addListener(&views);
+
+  // Each view walks in the same order as a stable sort with its comparator
+  auto matches = [&](SortOrder order, bool (*compare)(const Recipe*, const Recipe*)) {
+    std::vector<Recipe*> sorted;
+    for (LinkedList<Recipe*>::const_iterator it = recipes.cbegin(); it != recipes.cend(); ++it) {
+      if (store.contains((*it)->getId())) sorted.push_back(*it);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), compare);
+    const std::vector<RecipeId>& view = views.view(order);
+    assert(view.size() == sorted.size());
+    for (std::size_t i = 0; i < view.size(); ++i) assert(store.get(view[i]) == sorted[i]);
+  };
+  matches(SortOrder::Title, Recipe::compareByTitle);
+  matches(SortOrder::PrepTime, Recipe::compareByPrepTime);
+  matches(SortOrder::MealType, Recipe::compareByMealType);
+
+  // Edits, adds and removals keep every view ordered
+  Recipe* first = store.get(views.view(SortOrder::Title)[0]);
+  first->setTitle("Zucchini Fritters");
+  first->setPrepTime(1);
+  first->setMealType(MealType::Other);
+  assert(store.get(views.view(SortOrder::Title).back()) == first);
+  assert(store.get(views.view(SortOrder::PrepTime).front()) == first);
+  matches(SortOrder::MealType, Recipe::compareByMealType);
+  Recipe* added = createRecipeFromData("Aubergine Bake", 45, MealType::Breakfast, DietType::Vegan);
+  recipes.push_back(added);
+  store.add(added);
+  assert(views.size() == 61 && store.get(views.view(SortOrder::Title)[0]) == added);
+  store.remove(first->getId());
+  assert(views.size() == 60);
+  matches(SortOrder::Title, Recipe::compareByTitle);
+  matches(SortOrder::PrepTime, Recipe::compareByPrepTime);
+  matches(SortOrder::MealType, Recipe::compareByMealType);
+
+  // Cleanup
+  recipes.clear();
+  assert(views.size() == 0 && views.view(SortOrder::Title).empty());
+}
+
+void testTitleLookup() {
+  std::cout << "Testing TitleLookup...\n";
+
+  LinkedList<Recipe*> recipes;
+  Recipe* soup = createRecipeFromData("Tomato Soup", 30, MealType::Lunch, DietType::Vegan);
+  Recipe* soupAgain = createRecipeFromData("Tomato Soup", 45, MealType::Dinner, DietType::Omnivore);
+  Recipe* shouty = createRecipeFromData("TOMATO SOUP", 20, MealType::Lunch, DietType::Vegetarian);
+  Recipe* toast = createRecipeFromData("Toast", 5, MealType::Breakfast, DietType::Vegan);
+  recipes.push_back(soup);
+  recipes.push_back(soupAgain);
+  recipes.push_back(shouty);
+  recipes.push_back(toast);
+  RecipeStore store;
+  store.addAll(recipes);
+  TitleLookup titles;
+  store.addListener(&titles);
+  assert(titles.titleCount() == 3);
+
+  // Duplicates are all reported, in id order
+  assert(titles.find("Tomato Soup") == PostingList({ soup->getId(), soupAgain->getId() }));
+  assert(titles.find("tomato soup").empty());
+  assert(titles.findIgnoringCase("tomato soup").size() == 3);
+  assert(titles.find("Toast") == PostingList({ toast->getId() }));
+
+  // Renames and removals keep both maps current
+  soupAgain->setTitle("Roasted Tomato Soup");
+  assert(titles.find("Tomato Soup") == PostingList({ soup->getId() }));
+  assert(titles.find("Roasted Tomato Soup") == PostingList({ soupAgain->getId() }));
+  assert(titles.findIgnoringCase("TOMATO soup").size() == 2);
+  RecipeId toastId = toast->getId();
+  recipes.remove(toast);
+  delete toast;
+  assert(titles.find("Toast").empty() && titles.findIgnoringCase("toast").empty());
+  assert(!store.contains(toastId));
+
+  // Cleanup
+  recipes.clear();
+  assert(titles.titleCount() == 0);
+}
+
+// Values front to back, after checking that prev links and tail mirror the next chain
+std::vector<int> checkedValues(const LinkedList<int>& list) {
+  std::vector<int> values;
+  auto* node = list.getHead();
+  decltype(node) previous = nullptr;
+  while (node) {
+    assert(node->prev == previous);
+    values.push_back(node->value);
+    previous = node;
+    node = node->next;
+  }
+  assert(list.getTail() == previous && list.size() == static_cast<int>(values.size()));
+  return values;
+}
+
+void testLinkedListErase() {
+  std::cout << "Testing LinkedList erase/splice/merge...\n";
+
+  // erase by handle: middle, head and tail, then keep appending
+  LinkedList<int> list;
+  for (int i = 0; i < 6; ++i) list.push_back(i);
+  LinkedList<int>::iterator it = list.begin();
+  ++it;
+  ++it;
+  it = list.erase(it); // Removes 2
+  assert(*it == 3);
+  list.erase(list.begin());
+  LinkedList<int>::iterator last = list.begin();
+  while (last != list.end() && *last != 5) ++last;
+  assert(list.erase(last) == list.end());
+  list.push_back(6); // Must not write through the erased tail
+  assert(checkedValues(list) == std::vector<int>({ 1, 3, 4, 6 }));
+  bool threw = false;
+  try { list.erase(list.end()); } catch (const std::out_of_range&) { threw = true; }
+  assert(threw);
+
+  // erase_if removes every match in one pass
+  for (int i = 7; i < 20; ++i) list.push_back(i);
+  assert(list.erase_if([](int value) { return value % 3 == 0; }) == 6);
+  assert(checkedValues(list) == std::vector<int>({ 1, 4, 7, 8, 10, 11, 13, 14, 16, 17, 19 }));
+  assert(list.erase_if([](int) { return true; }) == 11 && list.isEmpty() && checkedValues(list).empty());
+
+  // splice between pooled lists (chunks adopted) and across allocation kinds
+  LinkedList<int> front;
+  LinkedList<int> middle;
+  LinkedList<int> perNode(NodeAllocation::PerNode);
+  for (int i = 0; i < 3; ++i) front.push_back(i);
+  for (int i = 10; i < 40; ++i) middle.push_back(i);
+  for (int i = 100; i < 103; ++i) perNode.push_back(i);
+  LinkedList<int>::iterator second = front.begin();
+  ++second;
+  front.splice(second, middle);
+  assert(middle.isEmpty() && checkedValues(middle).empty());
+  front.splice(front.end(), perNode);
+  assert(perNode.isEmpty() && front.size() == 36);
+  std::vector<int> values = checkedValues(front);
+  assert(values[0] == 0 && values[1] == 10 && values[30] == 39 && values[31] == 1 && values[35] == 102);
+  middle.push_back(7); // The emptied list starts a fresh pool
+  front.push_back(8);  // Adopted chunks and the list's own pool both stay usable
+  front.erase_if([](int value) { return value >= 10 && value < 20; });
+  assert(checkedValues(front).size() == 27 && checkedValues(middle) == std::vector<int>({ 7 }));
+
+  // merge keeps order and stability, and leaves the other list empty
+  // (second members of 'left' are all smaller, so ties must keep them first)
+  LinkedList<std::pair<int, int> > left;
+  LinkedList<std::pair<int, int> > right;
+  for (int i = 0; i < 20; ++i) left.push_back(std::make_pair(i / 2, i));
+  for (int i = 20; i < 40; ++i) right.push_back(std::make_pair((i - 20) / 3, i));
+  left.merge(right, compareFirst);
+  checkSortedPairs(left, 40);
+  assert(right.isEmpty());
+  LinkedList<std::pair<int, int> > empty;
+  empty.merge(left, compareFirst);
+  checkSortedPairs(empty, 40);
+}
+
+void testLinkedListIteration() {
+  std::cout << "Testing LinkedList bidirectional iteration...\n";
+
+  LinkedList<int> list;
+  for (int i = 0; i < 300; ++i) list.push_back(i);
+
+  // Stepping back from end(), reverse iterators and std algorithms
+  LinkedList<int>::iterator last = list.end();
+  --last;
+  assert(*last == 299 && *(--last) == 298);
+  std::vector<int> reversed(list.rbegin(), list.rend());
+  assert(reversed.size() == 300 && reversed.front() == 299 && reversed.back() == 0);
+  const LinkedList<int>& constList = list;
+  assert(*constList.rbegin() == 299 && std::distance(constList.rbegin(), constList.rend()) == 300);
+  std::reverse(list.begin(), list.end()); // Needs bidirectional iterators
+  assert(*list.begin() == 299 && *list.rbegin() == 0);
+  std::reverse(list.begin(), list.end());
+  LinkedList<int>::const_iterator converted = list.begin();
+  assert(*converted == 0);
+
+  // Positional access through the skip index, kept right across changes
+  assert(*list.iteratorAt(0) == 0 && *list.iteratorAt(63) == 63 && *list.iteratorAt(64) == 64);
+  assert(*list.iteratorAt(299) == 299 && *constList.iteratorAt(150) == 150);
+  for (int i = 300; i < 400; ++i) list.push_back(i); // Extends the index
+  assert(*list.iteratorAt(320) == 320 && *list.iteratorAt(399) == 399);
+  list.erase(list.iteratorAt(10));                  // Rebuilds it
+  assert(*list.iteratorAt(10) == 11 && *list.iteratorAt(398) == 399);
+  list.sort(std::greater<int>());
+  assert(*list.iteratorAt(0) == 399 && *list.iteratorAt(398) == 0);
+  bool threw = false;
+  try { list.iteratorAt(399); } catch (const std::out_of_range&) { threw = true; }
+  assert(threw);
+  threw = false;
+  try { LinkedList<int>().iteratorAt(0); } catch (const std::out_of_range&) { threw = true; }
+  assert(threw);
+}
+
+void testSmallList() {
+  std::cout << "Testing SmallList (inline segment plus overflow chunks)...\n";
+
+  // Up to the inline capacity nothing overflows; beyond it, chunks are chained
+  SmallList<std::string, 4> list;
+  assert(list.isEmpty() && list.begin() == list.end() && list.segmentCount() == 1);
+  for (int i = 0; i < 4; ++i) list.push_back(std::to_string(i));
+  assert(list.size() == 4 && list.segmentCount() == 1);
+  for (int i = 4; i < 10; ++i) list.push_back(std::to_string(i));
+  assert(list.size() == 10 && list.segmentCount() == 3);
+  int expected = 0;
+  for (const std::string& value : list) assert(value == std::to_string(expected++));
+  assert(expected == 10);
+  SmallList<std::string, 4>::iterator last = list.end();
+  assert(*(--last) == "9" && *list.rbegin() == "9" && std::distance(list.begin(), list.end()) == 10);
+
+  // Erasing shifts within a segment and folds half-empty neighbours together
+  SmallList<std::string, 4>::iterator it = list.begin();
+  std::advance(it, 3);
+  it = list.erase(it);
+  assert(*it == "4" && list.size() == 9);
+  for (it = list.begin(); it != list.end();) {
+    if (std::stoi(*it) % 2 == 0) it = list.erase(it); else ++it;
+  }
+  std::vector<std::string> odd(list.begin(), list.end());
+  assert(odd.size() == 4 && odd[0] == "1" && odd[1] == "5" && odd[3] == "9");
+  assert(list.segmentCount() == 1);
+  bool threw = false;
+  try { list.erase(list.end()); } catch (const std::out_of_range&) { threw = true; }
+  assert(threw);
+
+  // Copies are deep; moves leave the source empty and usable
+  for (int i = 10; i < 20; ++i) list.push_back(std::to_string(i));
+  SmallList<std::string, 4> copy(list);
+  *copy.begin() = "changed";
+  assert(*list.begin() == "1" && copy.size() == list.size());
+  SmallList<std::string, 4> moved(std::move(copy));
+  assert(copy.isEmpty() && moved.size() == 14 && *moved.begin() == "changed" && *moved.rbegin() == "19");
+  copy.push_back("again");
+  assert(copy.size() == 1 && *copy.begin() == "again");
+  moved = list;
+  assert(std::equal(moved.begin(), moved.end(), list.begin()));
+  list.clear();
+  assert(list.isEmpty() && list.segmentCount() == 1);
+
+  // Recipes keep their ingredients in one and copy them deeply
+  VeganRecipe salad("Salad", 10, MealType::Lunch);
+  salad.addIngredient(Ingredient("Lettuce", "1 head"));
+  salad.addIngredient(Ingredient("Tomato", "2"));
+  VeganRecipe copied(salad);
+  salad.removeIngredient("Lettuce");
+  assert(salad.getIngredients().size() == 1 && copied.getIngredients().size() == 2);
+  assert(copied.getIngredients().begin()->getName() == "Lettuce");
+}
+
+void testCopyAndMove() {
+  std::cout << "Testing LinkedList and Recipe copy/move...\n";
+
+  // Copies are deep and keep the allocation; moves steal and leave the source usable
+  LinkedList<std::string> words(NodeAllocation::PerNode);
+  for (int i = 0; i < 100; ++i) words.push_back(std::to_string(i));
+  LinkedList<std::string> copy(words);
+  *copy.begin() = "changed";
+  assert(*words.begin() == "0" && copy.size() == 100 && copy.getAllocation() == NodeAllocation::PerNode);
+  assert(*words.iteratorAt(70) == "70");
+  LinkedList<std::string> moved(std::move(words));
+  assert(words.isEmpty() && moved.size() == 100 && *moved.iteratorAt(70) == "70" && *moved.rbegin() == "99");
+  words.push_back("again");
+  assert(words.size() == 1 && *words.begin() == "again");
+  copy = moved;
+  assert(copy.size() == 100 && *copy.begin() == "0");
+  copy = copy;
+  assert(copy.size() == 100);
+  LinkedList<std::string> pooled;
+  pooled.push_back("pooled");
+  pooled = std::move(copy);
+  assert(pooled.size() == 100 && copy.isEmpty() && pooled.getAllocation() == NodeAllocation::PerNode);
+
+  // Owning pointer lists move without double-freeing
+  LinkedList<Recipe*> owned;
+  owned.push_back(createRecipeFromData("Owned", 5, MealType::Snack, DietType::Vegan));
+  LinkedList<Recipe*> owner(std::move(owned));
+  assert(owned.isEmpty() && owner.size() == 1);
+  owner.clear();
+
+  // Detached recipes: copies carry the data, moves steal it
+  VeganRecipe salad("Salad", 10, MealType::Lunch);
+  salad.addIngredient(Ingredient("Lettuce", "1 head"));
+  VeganRecipe copied(salad);
+  VeganRecipe stolen(std::move(salad));
+  assert(stolen.getTitle() == "Salad" && stolen.getIngredients().size() == 1);
+  assert(salad.getIngredients().isEmpty() && copied.getIngredients().size() == 1);
+
+  // Recipes in a store: copies are detached, moving out copies, and
+  // assigning in notifies the store and its indexes
+  LinkedList<Recipe*> recipes;
+  Recipe* soup = createRecipeFromData("Soup", 30, MealType::Dinner, DietType::Vegan);
+  soup->addIngredient(Ingredient("Lentils", "200g"));
+  recipes.push_back(soup);
+  RecipeStore store;
+  store.addAll(recipes);
+  IngredientIndex ingredients;
+  store.addListener(&ingredients);
+  VeganRecipe soupCopy(*static_cast<VeganRecipe*>(soup));
+  assert(soupCopy.getId() == INVALID_RECIPE_ID && soup->getId() == 0);
+  VeganRecipe soupMoved(std::move(*static_cast<VeganRecipe*>(soup)));
+  assert(soup->getTitle() == "Soup" && soup->getIngredients().size() == 1 && soupMoved.getTitle() == "Soup");
+  *soup = std::move(stolen);
+  assert(soup->getId() == 0 && store.getTitle(0) == "Salad" && store.getPrepTime(0) == 10);
+  assert(ingredients.lookup("lettuce") == PostingList({ 0 }) && ingredients.lookup("lentils").empty());
+  recipes.clear();
+  assert(!store.contains(0));
+}